@@ -0,0 +1,103 @@
+#pragma once
+
+namespace helios::core
+{
+    class ImageDecoder;
+
+    // Pixel data of an image decoded by stb_image (always 4 components per pixel). Owns the pixel data, which is freed
+    // (and its size returned to the decoder's staging budget) when the image is destroyed. The image is meant to live
+    // only until its data has been copied into upload memory.
+    class DecodedImage
+    {
+      public:
+        DecodedImage() = default;
+        ~DecodedImage();
+
+        DecodedImage(const DecodedImage& other) = delete;
+        DecodedImage& operator=(const DecodedImage& other) = delete;
+
+        DecodedImage(DecodedImage&& other) noexcept;
+        DecodedImage& operator=(DecodedImage&& other) noexcept;
+
+        const std::byte* getData() const
+        {
+            return m_data;
+        }
+
+        uint32_t getWidth() const
+        {
+            return m_width;
+        }
+
+        uint32_t getHeight() const
+        {
+            return m_height;
+        }
+
+        size_t getSizeInBytes() const
+        {
+            return m_sizeInBytes;
+        }
+
+      private:
+        friend class ImageDecoder;
+
+        void release();
+
+      private:
+        ImageDecoder* m_decoder{};
+
+        std::byte* m_data{};
+        uint32_t m_width{};
+        uint32_t m_height{};
+        size_t m_sizeInBytes{};
+    };
+
+    // Decodes image files (using stb_image) into CPU memory for upload. The total size of the decoded images that are
+    // alive at any time is bounded by the staging budget : when loading many textures in parallel, decoding blocks
+    // until enough previously decoded images have been uploaded (and destroyed). This bounds the peak memory usage of
+    // scene loading regardless of the number of worker threads and textures.
+    // An image that is larger than the whole budget is only decoded once no other image is alive.
+    // Note : A thread must not hold on to a DecodedImage while decoding another image, as it may wait for its own image
+    // to be released.
+    class ImageDecoder
+    {
+      public:
+        static constexpr size_t DEFAULT_STAGING_BUDGET = 512u * 1024u * 1024u;
+
+        explicit ImageDecoder(const size_t stagingBudget);
+
+        ImageDecoder(const ImageDecoder& other) = delete;
+        ImageDecoder& operator=(const ImageDecoder& other) = delete;
+
+        ImageDecoder(ImageDecoder&& other) = delete;
+        ImageDecoder& operator=(ImageDecoder&& other) = delete;
+
+        static ImageDecoder& get();
+
+        // LDR images are decoded to 8 bits per component, HDR images to 32 bit floats per component.
+        [[nodiscard]] DecodedImage decode(const std::string_view imagePath);
+        [[nodiscard]] DecodedImage decodeHDR(const std::string_view imagePath);
+
+        size_t getStagingBudget() const
+        {
+            return m_stagingBudget;
+        }
+
+      private:
+        friend class DecodedImage;
+
+        DecodedImage decode(const std::string_view imagePath, const bool isHDR);
+
+        // Blocks until sizeInBytes fits in the staging budget.
+        void reserve(const size_t sizeInBytes);
+        void release(const size_t sizeInBytes);
+
+      private:
+        const size_t m_stagingBudget{};
+
+        size_t m_reservedSize{};
+        std::mutex m_mutex{};
+        std::condition_variable m_releaseCondition{};
+    };
+} // namespace helios::core
@@ -0,0 +1,163 @@
+#pragma once
+
+namespace helios::core
+{
+    // Tracks the number of jobs (submitted with this counter) that have not yet completed. Counters are also used to
+    // express dependencies : a job submitted with a dependency is only pushed to the queues once the dependency
+    // counter reaches zero.
+    // Counters are neither copyable nor movable, and must outlive the jobs that reference them (usually the counter
+    // lives on the stack of the function that submits the jobs and waits on it).
+    class JobCounter
+    {
+      public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter& other) = delete;
+        JobCounter& operator=(const JobCounter& other) = delete;
+
+        JobCounter(JobCounter&& other) = delete;
+        JobCounter& operator=(JobCounter&& other) = delete;
+
+        bool isComplete() const
+        {
+            return m_count.load(std::memory_order_acquire) == 0u;
+        }
+
+      private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_count{};
+
+        // Jobs that depend on this counter, and are pushed to the queues once it reaches zero.
+        mutable std::mutex m_dependentJobsMutex{};
+        std::vector<std::function<void()>> m_dependentJobs{};
+    };
+
+    // Persistent pool of worker threads (one per hardware thread, minus the thread that submits the work) that execute
+    // small jobs. Each worker owns a deque : jobs submitted by a worker are pushed to its own deque and popped in LIFO
+    // order (cache friendly for nested jobs), while idle workers steal from the other end of the other deques. Jobs
+    // submitted from threads that are not workers go to a shared queue.
+    // Waiting on a counter never blocks the calling thread while there is work left : the waiting thread executes
+    // (or steals) pending jobs until the counter reaches zero. Because of this, jobs can submit and wait on nested
+    // jobs without deadlocking the pool.
+    // Jobs that are forked (see fork) are referenced rather than copied, and are queued in a fixed size queue that is
+    // drained before the other queues, so per frame work (such as recording the command lists of the render passes)
+    // runs on the parked workers without allocating or creating threads.
+    // There is a single job system for the process (see JobSystem::get), created lazily on first use.
+    class JobSystem
+    {
+      public:
+        static constexpr uint32_t MAX_FORKED_JOBS = 64u;
+
+        explicit JobSystem(const uint32_t workerCount);
+        ~JobSystem();
+
+        JobSystem(const JobSystem& other) = delete;
+        JobSystem& operator=(const JobSystem& other) = delete;
+
+        JobSystem(JobSystem&& other) = delete;
+        JobSystem& operator=(JobSystem&& other) = delete;
+
+        static JobSystem& get();
+
+        uint32_t getWorkerCount() const
+        {
+            return static_cast<uint32_t>(m_workerQueues.size());
+        }
+
+        // If counter is not null, it is incremented now and decremented once the job has completed.
+        void submit(std::function<void()> job, JobCounter* const counter = nullptr);
+
+        // The job is only executed after all jobs tracked by dependency have completed.
+        void submit(std::function<void()> job, JobCounter* const counter, JobCounter& dependency);
+
+        // Splits [0, count) into batches of batchSize and submits one job per batch, which calls job(i) for each index
+        // of the batch.
+        void dispatch(const uint32_t count, const uint32_t batchSize, std::function<void(const uint32_t)> job,
+                      JobCounter* const counter);
+
+        // Non allocating alternative to submit for fork / join parallelism : the job is not copied, so it must outlive
+        // the wait on the counter (see join). If the forked job queue is full, the job is executed on the calling
+        // thread.
+        template <typename Job>
+        void fork(const Job& job, JobCounter& counter)
+        {
+            forkJob(ForkedJob{
+                .job = &job,
+                .invoke = [](const void* const forkedJob) { (*static_cast<const Job*>(forkedJob))(); },
+                .counter = &counter,
+            });
+        }
+
+        // Temporaries would be destroyed before the job is executed.
+        template <typename Job>
+        void fork(const Job&& job, JobCounter& counter) = delete;
+
+        // Executes pending jobs on the calling thread until the counter reaches zero.
+        void wait(const JobCounter& counter);
+
+        // Waits for forked jobs. Unlike wait, only forked jobs are executed on the calling thread, so that the caller
+        // (such as the render thread joining the render passes) is not held up by long running jobs (such as model
+        // loading).
+        void join(const JobCounter& counter);
+
+      private:
+        struct ForkedJob
+        {
+            const void* job{};
+            void (*invoke)(const void* const job){};
+            JobCounter* counter{};
+        };
+
+        struct WorkerQueue
+        {
+            std::mutex mutex{};
+            std::deque<std::function<void()>> jobs{};
+        };
+
+        void workerLoop(const std::stop_token stopToken, const uint32_t workerIndex);
+
+        // Wraps the job so that the counter is decremented (and its dependent jobs are released) on completion.
+        std::function<void()> wrapJob(std::function<void()> job, JobCounter* const counter);
+
+        // Decrements the counter of a completed job, and releases its dependent jobs once it reaches zero.
+        void completeJob(JobCounter* const counter);
+
+        void pushJob(std::function<void()> job);
+
+        void forkJob(const ForkedJob& forkedJob);
+        void executeForkedJob(const ForkedJob& forkedJob);
+
+        // Wakes a worker once a job has been queued.
+        void wakeWorker();
+
+        // Pops a job from the calling worker's deque, or steals one from the shared queue / another worker.
+        std::optional<std::function<void()>> popJob();
+
+        std::optional<ForkedJob> popForkedJob();
+
+        // Executes a forked job if there is one, and otherwise a job popped with popJob. Returns false if there were no
+        // pending jobs.
+        bool executePendingJob();
+
+      private:
+        std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues{};
+
+        // Queue for jobs submitted from threads that are not workers.
+        WorkerQueue m_sharedQueue{};
+
+        // Ring buffer of the forked jobs, which are executed in the order they were forked.
+        std::array<ForkedJob, MAX_FORKED_JOBS> m_forkedJobs{};
+        uint32_t m_firstForkedJobIndex{};
+        uint32_t m_forkedJobCount{};
+        std::mutex m_forkedJobsMutex{};
+
+        // Number of jobs in all queues, used to put idle workers to sleep.
+        std::atomic<uint32_t> m_pendingJobCount{};
+        std::mutex m_wakeMutex{};
+        std::condition_variable_any m_wakeCondition{};
+
+        // Declared last, so the workers are stopped and joined before the queues are destroyed.
+        std::vector<std::jthread> m_workers{};
+    };
+} // namespace helios::core
@@ -0,0 +1,46 @@
+#pragma once
+
+namespace helios::core
+{
+    // Read only view of a file that is mapped into the address space of the process (using Win32 file mappings).
+    // Pages are loaded lazily by the OS when accessed, so opening a large file is cheap and data can be handed off to
+    // upload buffers without any intermediate copies.
+    class MemoryMappedFile
+    {
+      public:
+        MemoryMappedFile() = default;
+        explicit MemoryMappedFile(const std::wstring_view filePath);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile& other) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        bool isValid() const
+        {
+            return m_data != nullptr;
+        }
+
+        const std::byte* getData() const
+        {
+            return m_data;
+        }
+
+        size_t getSize() const
+        {
+            return m_size;
+        }
+
+      private:
+        void close();
+
+      private:
+        HANDLE m_fileHandle{INVALID_HANDLE_VALUE};
+        HANDLE m_fileMappingHandle{};
+
+        const std::byte* m_data{};
+        size_t m_size{};
+    };
+} // namespace helios::core
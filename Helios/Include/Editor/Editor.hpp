@@ -53,6 +53,9 @@ namespace helios::editor
         // Handles camera and other scene related properties.
         void renderSceneProperties(scene::Scene& scene) const;
 
+        // Video memory budget and mip bias of the texture streamer.
+        void renderTextureStreamingProperties(const gfx::GraphicsDevice* const graphicsDevice) const;
+
         void renderDeferredGBuffer(const gfx::GraphicsDevice* const graphicsDevice,
                                    const rendering::DeferredGeometryBuffer& deferredGBuffer) const;
 
@@ -31,6 +31,18 @@ namespace helios::gfx
             return m_fence->GetCompletedValue();
         }
 
+        // The fence value of the next signal, which completes after all commands executed on the queue so far.
+        uint64_t getNextFenceValue() const
+        {
+            return m_monotonicallyIncreasingFenceValue + 1u;
+        }
+
+        // The fence value of the last signal (which may not have completed yet).
+        uint64_t getLastSignaledFenceValue() const
+        {
+            return m_monotonicallyIncreasingFenceValue;
+        }
+
         // The user / engine must take care that a context passed into the execute function can be used in the future
         // (i.e proper synchronization must occur).
         // For now, each context consist of a command list and command allocator, and there is one command list per
@@ -43,6 +55,10 @@ namespace helios::gfx
         uint64_t signal();
         void waitForFenceValue(const uint64_t fenceValue) const;
 
+        // GPU side wait : commands submitted to this queue after the call only execute once the fence of commandQueue
+        // has reached fenceValue.
+        void waitForQueue(const CommandQueue& commandQueue, const uint64_t fenceValue) const;
+
         void flush();
 
       private:
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Core/MemoryMappedFile.hpp"
+
+namespace helios::gfx
+{
+    // Layout of a single mip level (subresource) of a 2D texture.
+    struct SubresourceLayout
+    {
+        // Offset (in bytes) of the subresource from the start of the texture data.
+        size_t offset{};
+
+        uint32_t width{};
+        uint32_t height{};
+
+        // Size of a row of blocks (block compressed formats) / pixels, and the number of such rows.
+        uint32_t rowPitch{};
+        uint32_t rowCount{};
+
+        size_t getSizeInBytes() const
+        {
+            return static_cast<size_t>(rowPitch) * rowCount;
+        }
+    };
+
+    struct DDSTextureDesc
+    {
+        DXGI_FORMAT format{DXGI_FORMAT_UNKNOWN};
+        uint32_t width{};
+        uint32_t height{};
+        uint32_t mipLevels{1u};
+
+        // Written to a reserved field of the header, so that cooked files can be invalidated when the process that
+        // produced them changes (see TextureCache).
+        uint32_t cookVersion{};
+    };
+
+    // Reads and writes 2D textures (with a full or partial mip chain) stored in DDS files. Files are always written
+    // with the DX10 header extension (so any DXGI format can be stored). For reading, the legacy DXT1 / DXT5 / ATI1 /
+    // ATI2 (BC1 / BC3 / BC4 / BC5) four CC codes are supported as well.
+    // The data of all mip levels is tightly packed (mip 0 first), with no padding between rows.
+    // Reference : https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dx-graphics-dds-pguide.
+    class DDSFile
+    {
+      public:
+        // Returns the layout of all mip levels of a texture (tightly packed).
+        [[nodiscard]] static std::vector<SubresourceLayout> getSubresourceLayouts(const DXGI_FORMAT format,
+                                                                                  const uint32_t width,
+                                                                                  const uint32_t height,
+                                                                                  const uint32_t mipLevels);
+
+        // data must hold the tightly packed data of all mip levels (see getSubresourceLayouts).
+        static void write(const std::wstring_view filePath, const DDSTextureDesc& textureDesc,
+                          std::span<const std::byte> data);
+
+        // Memory maps the file. Returns std::nullopt if the file does not exist or is not a valid 2D texture.
+        [[nodiscard]] static std::optional<DDSFile> open(const std::wstring_view filePath);
+
+        const DDSTextureDesc& getTextureDesc() const
+        {
+            return m_textureDesc;
+        }
+
+        std::span<const SubresourceLayout> getSubresourceLayouts() const
+        {
+            return m_subresourceLayouts;
+        }
+
+        // Pointer to the data of all mip levels (within the memory mapped file).
+        const std::byte* getData() const
+        {
+            return m_data;
+        }
+
+      private:
+        core::MemoryMappedFile m_file{};
+
+        DDSTextureDesc m_textureDesc{};
+        std::vector<SubresourceLayout> m_subresourceLayouts{};
+        const std::byte* m_data{};
+    };
+} // namespace helios::gfx
@@ -0,0 +1,96 @@
+#pragma once
+
+namespace helios::gfx
+{
+    // Allocates the descriptor indices of a descriptor heap. The heap is split into a persistent region, for the
+    // descriptors of long lived resources (textures, buffers, samplers, etc), and a ring with one region per frame in
+    // flight for transient descriptors that are only valid for the frame they were allocated in.
+    // Resources are created from many threads at once (models create their textures and meshes in jobs), so the common
+    // case of allocation does not take a lock. Persistent descriptors are reserved from a cursor that is advanced
+    // atomically : each thread reserves a chunk of THREAD_CACHE_DESCRIPTOR_COUNT descriptors at a time and allocates
+    // single descriptors from its chunk, while contiguous ranges are reserved from the cursor directly. Descriptors
+    // reserved by a thread that have not been allocated are freed when the thread exits.
+    // Persistent descriptors are recycled once freed. Single descriptors (the common case, such as the SRV of a
+    // buffer) are returned to a list of free descriptors, while contiguous ranges (such as the per mip UAV's of a
+    // texture) are returned to a list of free ranges that is kept sorted, so that adjacent ranges are merged. Once the
+    // cursor reaches the end of the persistent region, descriptors are allocated from these lists under a lock (once
+    // per chunk for single descriptors). Ranges are allocated first fit, and the free single descriptors are merged
+    // into the ranges when no range is large enough.
+    // free does not wait for the GPU : descriptors that may still be used by frames in flight are to be freed through
+    // GraphicsDevice::deferRelease.
+    // Transient descriptors are allocated with a single atomic add.
+    class DescriptorAllocator
+    {
+      public:
+        static constexpr uint32_t THREAD_CACHE_DESCRIPTOR_COUNT = 32u;
+
+        // The transient descriptors of frame i start at index
+        // persistentDescriptorCount + i * transientDescriptorCountPerFrame.
+        explicit DescriptorAllocator(const uint32_t persistentDescriptorCount,
+                                     const uint32_t transientDescriptorCountPerFrame);
+        ~DescriptorAllocator();
+
+        DescriptorAllocator(const DescriptorAllocator& other) = delete;
+        DescriptorAllocator& operator=(const DescriptorAllocator& other) = delete;
+
+        DescriptorAllocator(DescriptorAllocator&& other) = delete;
+        DescriptorAllocator& operator=(DescriptorAllocator&& other) = delete;
+
+        // Returns the index of the first of count contiguous persistent descriptors.
+        [[nodiscard]] uint32_t allocate(const uint32_t count = 1u);
+        void free(const uint32_t index, const uint32_t count = 1u);
+
+        // Returns the index of the first of count contiguous descriptors, that are valid until the region of the
+        // current frame is reset.
+        [[nodiscard]] uint32_t allocateTransient(const uint32_t count = 1u);
+
+        // Makes the transient region of frameIndex the current one, and resets it. The GPU must have completed the
+        // frame that last used the region, and no other thread may allocate transient descriptors during the call.
+        void resetFrame(const uint32_t frameIndex);
+
+        uint32_t getPersistentDescriptorCount() const
+        {
+            return m_persistentDescriptorCount;
+        }
+
+      private:
+        struct DescriptorRange
+        {
+            uint32_t index{};
+            uint32_t count{};
+        };
+
+        // Reserves count descriptors from the cursor (or as many as are left if allowPartial is true). The returned
+        // range is empty if none could be reserved.
+        DescriptorRange reserveFromCursor(const uint32_t count, const bool allowPartial);
+
+        // Reserves the next chunk of descriptors of the calling thread.
+        DescriptorRange reserveThreadCacheDescriptors();
+
+        // Inserts the range into m_freeRanges, merging it with the adjacent free ranges.
+        void addFreeRange(const DescriptorRange& descriptorRange);
+
+        // Moves the free single descriptors into m_freeRanges (so that they can be part of larger ranges).
+        void mergeFreeDescriptors();
+
+      private:
+        uint64_t m_allocatorId{};
+
+        uint32_t m_persistentDescriptorCount{};
+        uint32_t m_transientDescriptorCountPerFrame{};
+
+        // Descriptors before the cursor have been reserved (by a thread or as a range) at least once.
+        std::atomic<uint32_t> m_persistentDescriptorCursor{};
+
+        std::vector<uint32_t> m_freeDescriptors{};
+
+        // Sorted by index, and no two ranges are adjacent.
+        std::vector<DescriptorRange> m_freeRanges{};
+
+        // Protects the free lists.
+        std::mutex m_mutex{};
+
+        uint32_t m_frameIndex{};
+        std::atomic<uint32_t> m_frameDescriptorCount{};
+    };
+} // namespace helios::gfx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "DescriptorAllocator.hpp"
+
 namespace helios::gfx
 {
     // Holds a CPU and GPU descriptor handle.
@@ -17,16 +19,24 @@ namespace helios::gfx
         }
     };
 
-    // DescriptorHeap abstraction that has a 'current descriptor' that comes in handy while initializing resource
-    // (Texture's, buffer's etc). Has methods to return index of current descriptor : most resource abstractions
-    // (texture's, buffer's) etc store this index and use for bindless rendering.
+    // DescriptorHeap abstraction with methods to allocate descriptors (see DescriptorAllocator) when initializing
+    // resources (Texture's, buffer's etc), and to free them once the resource is released. Descriptors are identified
+    // by their index : most resource abstractions (texture's, buffer's) etc store this index and use for bindless
+    // rendering.
     // DescriptorHeap is a contiguous linear allocation which stores descriptor's, which are tiny blocks of memory
-    // describing a resource.
+    // describing a resource. The heap has persistentDescriptorCount persistent descriptors, followed by
+    // transientDescriptorCountPerFrame transient descriptors for each of the frameCount frames in flight.
+    // Shader visible heaps (CBV / SRV / UAV and sampler) are often in write combined memory, which is slow to write
+    // to. Views are therefore created in a CPU only staging heap with the same layout (see getStagingDescriptorHandle),
+    // and marked as staged. The staged descriptors are copied to the shader visible heap in bulk (contiguous
+    // descriptors with a single copy) by copyStagedDescriptors, which the device calls before executing command lists
+    // (see GraphicsDevice::executeContexts). Other heaps have no staging heap, and views are created in them directly.
     class DescriptorHeap
     {
       public:
         explicit DescriptorHeap(ID3D12Device* const device, const D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType,
-                                const uint32_t descriptorCount, const std::wstring_view descriptorHeapName);
+                                const uint32_t persistentDescriptorCount, const std::wstring_view descriptorHeapName,
+                                const uint32_t transientDescriptorCountPerFrame = 0u, const uint32_t frameCount = 1u);
         ~DescriptorHeap() = default;
 
         DescriptorHeap(const DescriptorHeap& other) = delete;
@@ -50,29 +60,64 @@ namespace helios::gfx
             return m_descriptorHandleFromHeapStart;
         };
 
-        DescriptorHandle getCurrentDescriptorHandle() const
-        {
-            return m_currentDescriptorHandle;
-        };
-
         DescriptorHandle getDescriptorHandleFromIndex(const uint32_t index) const;
 
+        // Handle that views are to be created at. Once created, the views must be marked as staged so that they are
+        // copied to the shader visible heap (no-op for heaps that are not shader visible).
+        D3D12_CPU_DESCRIPTOR_HANDLE getStagingDescriptorHandle(const uint32_t index) const;
+        void markDescriptorsStaged(const uint32_t index, const uint32_t count = 1u);
+
+        // Copies the descriptors staged so far to the shader visible heap. The copied descriptors must not be used by
+        // commands that may still be executing (as for descriptors written to the heap directly).
+        void copyStagedDescriptors();
+
         // Returns a index that can be used to directly index into a descriptor heap.
         [[nodiscard]] uint32_t getDescriptorIndex(const DescriptorHandle& descriptorHandle) const;
-        [[nodiscard]] uint32_t getCurrentDescriptorIndex() const;
+
+        // Returns the index of the first of count contiguous descriptors, which are valid until freed.
+        [[nodiscard]] uint32_t allocateDescriptors(const uint32_t count = 1u)
+        {
+            return m_descriptorAllocator.allocate(count);
+        }
+
+        // The descriptors must not be used by commands that may still be executing (see GraphicsDevice::deferRelease).
+        void freeDescriptors(const uint32_t index, const uint32_t count = 1u)
+        {
+            m_descriptorAllocator.free(index, count);
+        }
+
+        // Returns the index of the first of count contiguous descriptors, which are only valid for the current frame.
+        [[nodiscard]] uint32_t allocateTransientDescriptors(const uint32_t count = 1u)
+        {
+            return m_descriptorAllocator.allocateTransient(count);
+        }
+
+        // Called once the GPU has completed the frame that last used the transient descriptors of frameIndex.
+        void resetFrame(const uint32_t frameIndex)
+        {
+            m_descriptorAllocator.resetFrame(frameIndex);
+        }
 
         // Used to offset a X_Handle passed into function.
         void offsetDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE& handle, const uint32_t offset = 1u) const;
         void offsetDescriptor(D3D12_GPU_DESCRIPTOR_HANDLE& handle, const uint32_t offset = 1u) const;
         void offsetDescriptor(DescriptorHandle& handle, const uint32_t offset = 1u) const;
 
-        void offsetCurrentHandle(const uint32_t offset = 1u);
-
       private:
+        ID3D12Device* m_device{};
+        D3D12_DESCRIPTOR_HEAP_TYPE m_descriptorHeapType{};
+
         wrl::ComPtr<ID3D12DescriptorHeap> m_descriptorHeap{};
         uint32_t m_descriptorSize{};
 
+        wrl::ComPtr<ID3D12DescriptorHeap> m_stagingDescriptorHeap{};
+
+        // One bit per descriptor, set when a descriptor is staged and cleared once it has been copied.
+        std::vector<std::atomic<uint64_t>> m_stagedDescriptorMasks{};
+        std::mutex m_copyMutex{};
+
         DescriptorHandle m_descriptorHandleFromHeapStart{};
-        DescriptorHandle m_currentDescriptorHandle{};
+
+        DescriptorAllocator m_descriptorAllocator;
     };
 } // namespace helios::gfx
\ No newline at end of file
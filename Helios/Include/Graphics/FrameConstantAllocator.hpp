@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Resources.hpp"
+
+namespace helios::gfx
+{
+    class DescriptorHeap;
+    class MemoryAllocator;
+
+    // The device abstraction will have an object of this type.
+    // Linear (bump) allocator for constant data that changes every frame. A single persistently mapped upload buffer is
+    // split into one region per frame in flight. Each allocation copies the data after the previous allocation of the
+    // frame, and writes a CBV for it into a transient descriptor of the bindless descriptor heap. A region (and the
+    // transient descriptors) is only reset once the frame that used it has completed on the GPU (see
+    // GraphicsDevice::endFrame), so the CPU never overwrites constants a frame in flight may still be reading.
+    // Allocations can be made from multiple threads (as the render passes are recorded in parallel).
+    class FrameConstantAllocator
+    {
+      public:
+        static constexpr uint64_t FRAME_CAPACITY = 1024ull * 1024ull;
+
+        explicit FrameConstantAllocator(ID3D12Device* const device, MemoryAllocator* const memoryAllocator,
+                                        DescriptorHeap* const cbvSrvUavDescriptorHeap, const uint32_t frameCount);
+
+        FrameConstantAllocator(const FrameConstantAllocator& other) = delete;
+        FrameConstantAllocator& operator=(const FrameConstantAllocator& other) = delete;
+
+        FrameConstantAllocator(FrameConstantAllocator&& other) = delete;
+        FrameConstantAllocator& operator=(FrameConstantAllocator&& other) = delete;
+
+        // The data is copied before the function returns. The returned buffer is only valid for the current frame.
+        [[nodiscard]] FrameConstantBuffer allocate(const void* data, const uint64_t sizeInBytes);
+
+        // Makes the region of frameIndex the current one, and resets it. The GPU must have completed the frame that
+        // last used the region.
+        void resetFrame(const uint32_t frameIndex);
+
+      private:
+        ID3D12Device& m_device;
+        DescriptorHeap& m_cbvSrvUavDescriptorHeap;
+
+        Allocation m_bufferAllocation{};
+        std::byte* m_bufferCpuAddress{};
+        D3D12_GPU_VIRTUAL_ADDRESS m_bufferGpuVirtualAddress{};
+
+        uint32_t m_frameIndex{};
+        uint64_t m_frameOffset{};
+
+        std::mutex m_mutex{};
+    };
+} // namespace helios::gfx
@@ -40,6 +40,15 @@ namespace helios::gfx
         void setComputeRootSignatureAndPipeline(const PipelineState& pipelineState) const;
         void set32BitComputeConstants(const void* renderResources) const;
 
+        // Constants that are only valid for the frame being recorded (see GraphicsDevice::allocateFrameConstants).
+        template <typename T>
+        [[nodiscard]] FrameConstantBuffer allocateFrameConstants(const T& data) const
+        {
+            return allocateFrameConstants(&data, sizeof(T));
+        }
+
+        [[nodiscard]] FrameConstantBuffer allocateFrameConstants(const void* data, const size_t sizeInBytes) const;
+
         void setViewport(const D3D12_VIEWPORT& viewport) const;
 
         void setPrimitiveTopologyLayout(const D3D_PRIMITIVE_TOPOLOGY primitiveTopology) const;
@@ -51,7 +60,8 @@ namespace helios::gfx
         void copyResource(ID3D12Resource* const source, ID3D12Resource* const destination) const;
 
         // Draw functions.
-        void drawInstanceIndexed(const uint32_t indicesCount, const uint32_t instanceCount = 1u) const;
+        void drawInstanceIndexed(const uint32_t indicesCount, const uint32_t instanceCount = 1u,
+                                 const uint32_t startIndexLocation = 0u) const;
         void drawIndexed(const uint32_t indicesCount, const uint32_t instanceCount = 1u) const;
 
         // Dispatch functions.
@@ -3,17 +3,40 @@
 #include "CommandQueue.hpp"
 #include "CopyContext.hpp"
 #include "DescriptorHeap.hpp"
+#include "FrameConstantAllocator.hpp"
 #include "GraphicsContext.hpp"
 #include "MemoryAllocator.hpp"
 #include "MipMapGenerator.hpp"
 #include "PipelineState.hpp"
+#include "ResourcePool.hpp"
 #include "Resources.hpp"
+#include "TextureStreamer.hpp"
+#include "UploadRingBuffer.hpp"
 
 namespace helios::gfx
 {
     struct FenceValues
     {
         uint64_t directQueueFenceValue{};
+        uint64_t computeQueueFenceValue{};
+        uint64_t copyQueueFenceValue{};
+    };
+
+    // Contiguous descriptors of a descriptor heap.
+    struct DescriptorRange
+    {
+        DescriptorHeap* descriptorHeap{};
+        uint32_t index{INVALID_INDEX_U32};
+        uint32_t count{1u};
+    };
+
+    // An allocation (and descriptors) that is released once the fences of all queues have reached the values they
+    // would signal next at the time of the release (i.e once the GPU has executed all the work that may use it).
+    struct DeferredRelease
+    {
+        Allocation allocation{};
+        std::vector<DescriptorRange> descriptorRanges{};
+        FenceValues fenceValues{};
     };
 
     // Abstraction for creating / destroying various graphics resources.
@@ -72,6 +95,16 @@ namespace helios::gfx
             return m_mipMapGenerator.get();
         }
 
+        TextureStreamer* const getTextureStreamer() const
+        {
+            return m_textureStreamer.get();
+        }
+
+        TexturePool* const getTexturePool() const
+        {
+            return m_texturePool.get();
+        }
+
         DXGI_FORMAT getSwapchainBackBufferFormat() const
         {
             return m_swapchainBackBufferFormat;
@@ -82,12 +115,14 @@ namespace helios::gfx
             return m_perFrameGraphicsContexts[m_currentFrameIndex];
         }
 
-        [[nodiscard]] std::unique_ptr<CopyContext>& getCopyContext()
+
+        // Index of the frame in flight being recorded. Resources that are written by the CPU every frame can have one
+        // copy per frame in flight, indexed by this.
+        [[nodiscard]] uint32_t getCurrentFrameIndex() const
         {
-            return m_copyContext;
+            return static_cast<uint32_t>(m_currentFrameIndex);
         }
 
-
         [[nodiscard]] Texture& getCurrentBackBuffer()
         {
             return m_backBuffers[m_currentFrameIndex];
@@ -96,8 +131,24 @@ namespace helios::gfx
         [[nodiscard]] std::unique_ptr<ComputeContext> getComputeContext();
         void executeAndFlushComputeContext(std::unique_ptr<ComputeContext>&& computeContext);
 
+        // Copies the staged descriptors to the shader visible heaps (see DescriptorHeap), and executes the contexts on
+        // the direct queue. Command lists that use the descriptors of the bindless heaps are to be executed through
+        // this function rather than the direct command queue.
+        void executeContexts(const std::span<const Context* const> contexts);
+
 
-        // Resets the current context (i.e the command list and the allocator).
+        // Submits the uploads recorded so far (see UploadRingBuffer), and makes the direct and compute queues wait (on
+        // the GPU) for them to complete. Called by beginFrame and before compute contexts are executed, so resources
+        // can be used on those queues right after they are created.
+        void flushUploads();
+
+        // Upload tickets of resources (see Buffer::uploadTicket) can be polled, or waited on by the CPU. A resource is
+        // only complete once its batch has been submitted (by flushUploads, or once enough uploads are pending).
+        [[nodiscard]] UploadTicket getLatestUploadTicket() const;
+        [[nodiscard]] bool isUploadComplete(const UploadTicket& uploadTicket) const;
+        void waitForUpload(const UploadTicket& uploadTicket) const;
+
+        // Resets the current context (i.e the command list and the allocator), and flushes the pending uploads.
         void beginFrame();
         void present();
 
@@ -106,17 +157,45 @@ namespace helios::gfx
 
         void resizeWindow(const uint32_t windowWidth, const uint32_t windowHeight);
 
-        // Creates a GPU Buffer. If some data is passed in, it will recursively call itself to create a upload buffer (a
-        // buffer with CPU write and GPU read access and placed in a UploadHead). Then, a copy command is issued so that
-        // the final Buffer returned by the function has the required data and is in exclusive GPU only memory.
+        // Resources must not be released while commands that use them may still be executing. Allocations passed here
+        // are released by endFrame once the GPU has executed all commands submitted (to any queue) before the call, so
+        // the caller does not have to flush the queues. Commands recorded after the call must not use the allocation.
+        void deferRelease(Allocation&& allocation) const;
+        void deferRelease(const DescriptorRange& descriptorRange) const;
+
+        // Releases the allocation of the resource along with all of its descriptors (as for deferRelease, once the GPU
+        // no longer uses them), so that the descriptors can be reused by other resources.
+        void deferRelease(Buffer&& buffer) const;
+        void deferRelease(Texture&& texture) const;
+
+        // Removes a reference to a texture of the texture pool. The texture is released (as for deferRelease) along
+        // with its last reference.
+        void releaseTexture(const TextureHandle textureHandle) const;
+
+        [[nodiscard]] VideoMemoryBudget getVideoMemoryBudget() const;
+
+        // Copies data that changes every frame into the frame constant allocator, returning a constant buffer that is
+        // only valid for the current frame (i.e until the next endFrame). Unlike constant buffers created with
+        // createBuffer, the data is never overwritten while a frame in flight may read it.
+        template <typename T>
+        [[nodiscard]] FrameConstantBuffer allocateFrameConstants(const T& data) const
+        {
+            return allocateFrameConstants(&data, sizeof(T));
+        }
+
+        [[nodiscard]] FrameConstantBuffer allocateFrameConstants(const void* data, const size_t sizeInBytes) const;
+
+        // Creates a GPU Buffer. If some data is passed in, it is staged in the upload ring buffer, and a copy into the
+        // buffer (which is in exclusive GPU only memory) is recorded. The function does not wait for the copy : the
+        // copies are submitted in batches (see flushUploads), and the returned buffer has a ticket for its upload.
         template <typename T>
         [[nodiscard]] Buffer createBuffer(const BufferCreationDesc& bufferCreationDesc,
                                           const std::span<const T> data = {}) const;
 
         // Creates a Texture that resides on GPU memory. The same Texture abstraction is used for render targets, depth
         // stencil texture, etc. If data is non-null, stb_image will be used to load texture (HDR and non HDR textures
-        // supported). In that case, a upload buffer will be created, after which a copy command is issued so that
-        // finally the texture on GPU only memory has the required data.
+        // supported). In that case, the data is staged in the upload ring buffer, and a copy into the texture on GPU
+        // only memory is recorded (as for createBuffer, the returned texture has a ticket for its upload).
         [[nodiscard]] Texture createTexture(const TextureCreationDesc& textureCreationDesc,
                                             const void* data = nullptr) const;
 
@@ -144,18 +223,32 @@ namespace helios::gfx
         void initContexts();
         void initBindlessRootSignature();
         void initMipMapGenerator();
+        void initTextureStreamer();
+        void initTexturePool();
 
         void createBackBufferRTVs();
 
+        void deferRelease(DeferredRelease&& deferredRelease) const;
+        void releaseCompletedResources();
+
+        void copyStagedDescriptors();
+
+        // If descriptorIndex is valid, the view is written to that (already allocated) descriptor, otherwise a new
+        // descriptor is allocated. Returns the index of the descriptor.
         [[nodiscard]] uint32_t createCbv(const CbvCreationDesc& cbvCreationDesc) const;
-        [[nodiscard]] uint32_t createSrv(const SrvCreationDesc& srvCreationDesc, ID3D12Resource* const resource) const;
-        [[nodiscard]] uint32_t createUav(const UavCreationDesc& uavCreationDesc, ID3D12Resource* const resource) const;
+        [[nodiscard]] uint32_t createSrv(const SrvCreationDesc& srvCreationDesc, ID3D12Resource* const resource,
+                                         const uint32_t descriptorIndex = INVALID_INDEX_U32) const;
+        [[nodiscard]] uint32_t createUav(const UavCreationDesc& uavCreationDesc, ID3D12Resource* const resource,
+                                         const uint32_t descriptorIndex = INVALID_INDEX_U32) const;
         [[nodiscard]] uint32_t createRtv(const RtvCreationDesc& rtvCreationDesc, ID3D12Resource* const resource) const;
         [[nodiscard]] uint32_t createDsv(const DsvCreationDesc& dsvCreationDesc, ID3D12Resource* const resource) const;
 
       public:
         static constexpr uint32_t FRAMES_IN_FLIGHT = 3u;
 
+        // Number of transient descriptors of the CBV / SRV / UAV heap per frame (used for the frame constants).
+        static constexpr uint32_t TRANSIENT_DESCRIPTORS_PER_FRAME = 256u;
+
       private:
         wrl::ComPtr<IDXGIFactory6> m_factory{};
         wrl::ComPtr<ID3D12Debug3> m_debug{};
@@ -172,11 +265,11 @@ namespace helios::gfx
         // The 3 here is based on the main function render loop. A much much cleaner solution would involve
         // a graphics context queue.
         std::array<std::array<std::unique_ptr<GraphicsContext>, 5u>, FRAMES_IN_FLIGHT> m_perFrameGraphicsContexts{};
-        std::unique_ptr<CopyContext> m_copyContext{};
         std::queue<std::unique_ptr<ComputeContext>> m_computeContextQueue{};
 
         std::array<FenceValues, FRAMES_IN_FLIGHT> m_fenceValues{};
         std::array<Texture, FRAMES_IN_FLIGHT> m_backBuffers{};
+        uint32_t m_backBufferRtvIndex{INVALID_INDEX_U32};
         uint64_t m_currentFrameIndex{};
 
         DXGI_FORMAT m_swapchainBackBufferFormat{};
@@ -192,8 +285,30 @@ namespace helios::gfx
         std::unique_ptr<MemoryAllocator> m_memoryAllocator{};
         std::unique_ptr<MipMapGenerator> m_mipMapGenerator{};
 
+        // Declared after the memory allocator, so that the ring buffer is released before it.
+        std::unique_ptr<UploadRingBuffer> m_uploadRingBuffer{};
+
+        // Declared after the memory allocator, so that the buffer is released before it.
+        std::unique_ptr<FrameConstantAllocator> m_frameConstantAllocator{};
+
+        // Fence value (of the copy queue) the direct and compute queues last waited for.
+        uint64_t m_uploadFenceValue{};
+
+        // Declared after the memory allocator, as the allocations are released through it.
+        mutable std::deque<DeferredRelease> m_deferredReleases{};
+        mutable std::mutex m_deferredReleaseMutex{};
+
+        // Declared after the memory allocator, so that the streamer (and the allocations it holds) is destroyed first.
+        std::unique_ptr<TextureStreamer> m_textureStreamer{};
+
+        // Textures that are shared by multiple owners (such as material textures), referred to by handle. Declared
+        // after the memory allocator, as the textures left in the pool are released through it.
+        std::unique_ptr<TexturePool> m_texturePool{};
+
+        // Serializes the submission of uploads (see flushUploads). Resources are created without a device wide lock, as
+        // the memory allocator, upload ring buffer and descriptor heaps are thread safe.
         mutable std::recursive_mutex m_resourceMutex{};
-        
+
         bool m_isInitialized{false};
 
         friend class MipMapGenerator;
@@ -209,47 +324,27 @@ namespace helios::gfx
         const uint32_t numberComponents = data.size() == 0 ? 1 : static_cast<uint32_t>(data.size());
 
         buffer.sizeInBytes = numberComponents * sizeof(T);
+        buffer.stride = static_cast<uint32_t>(sizeof(T));
 
         const ResourceCreationDesc resourceCreationDesc =
             ResourceCreationDesc::createBufferResourceCreationDesc(buffer.sizeInBytes);
 
         buffer.allocation = m_memoryAllocator->createBufferResourceAllocation(bufferCreationDesc, resourceCreationDesc);
 
-        std::scoped_lock<std::recursive_mutex> resourceLockGuard(m_resourceMutex);
-
-        // Currently, not using a backing storage for upload context's and such. Simply using D3D12MA to create a upload
-        // buffer, copy the data onto the upload buffer, and then copy data from upload buffer -> GPU only buffer.
-        if (data.data())
+        // Buffers in CPU visible memory are written directly, as they cannot be the destination of a copy.
+        if (data.data() && buffer.allocation.mappedPointer.has_value())
         {
-            // Create upload buffer.
-            const BufferCreationDesc uploadBufferCreationDesc = {
-                .usage = BufferUsage::UploadBuffer,
-                .name = L"Upload buffer - " + std::wstring(bufferCreationDesc.name),
-            };
-
-            Allocation uploadAllocation =
-                m_memoryAllocator->createBufferResourceAllocation(uploadBufferCreationDesc, resourceCreationDesc);
-
-            uploadAllocation.update(data.data(), buffer.sizeInBytes);
-
-            m_copyContext->reset();
-
-            // Get a copy command and list and execute copy resource functions on the command queue.
-            m_copyContext->getCommandList()->CopyResource(buffer.allocation.resource.Get(),
-                                                          uploadAllocation.resource.Get());
-
-            const std::array<helios::gfx::Context* const, 1u> contexts = {
-                m_copyContext.get(),
-            };
-
-            m_copyCommandQueue->executeContext(contexts);
-            m_copyCommandQueue->flush();
-
-            uploadAllocation.reset();
+            buffer.update(data.data());
+        }
+        else if (data.data())
+        {
+            buffer.uploadTicket =
+                m_uploadRingBuffer->uploadBuffer(buffer.allocation.resource.Get(), data.data(), buffer.sizeInBytes);
         }
 
         // Create relevant descriptor's.
-        if (bufferCreationDesc.usage == BufferUsage::StructuredBuffer)
+        if (bufferCreationDesc.usage == BufferUsage::StructuredBuffer ||
+            bufferCreationDesc.usage == BufferUsage::DynamicStructuredBuffer)
         {
             const SrvCreationDesc srvCreationDesc = {
                 .srvDesc =
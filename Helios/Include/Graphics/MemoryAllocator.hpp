@@ -4,6 +4,13 @@
 
 namespace helios::gfx
 {
+    // Video memory usage of the process and the budget the OS gives it (both for the GPU local memory segment).
+    struct VideoMemoryBudget
+    {
+        uint64_t usageBytes{};
+        uint64_t budgetBytes{};
+    };
+
     // Memory allocator handles allocation of GPU memory. As of now, D3D12 memory allocator is used.
     // D3D12MA is used rather than creation of committed resources. This is because Placed resources (which D3D12MA may
     // allocate) can be more memory efficient. Also, a lot of issues such as fragmentation are handled automatically by
@@ -29,6 +36,10 @@ namespace helios::gfx
 
         [[nodiscard]] Allocation createTextureResourceAllocation(const TextureCreationDesc& textureCreationDesc);
 
+        // Queried from D3D12MA (which uses IDXGIAdapter3::QueryVideoMemoryInfo), so the budget can change at run time
+        // (for example, when other applications allocate video memory).
+        [[nodiscard]] VideoMemoryBudget getVideoMemoryBudget();
+
       private:
         wrl::ComPtr<D3D12MA::Allocator> m_allocator{};
         std::recursive_mutex m_resourceAllocationMutex{};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Resources.hpp"
+
+namespace helios::gfx
+{
+    // 32 bit handle to a resource of a ResourcePool : the index of the slot that holds the resource, and the generation
+    // of the slot when the resource was added. The generation of a slot is incremented when its resource is removed,
+    // so handles to removed resources (stale handles) are detected by the pool. Handles are plain values, so copying
+    // them is free (unlike copying a resource, which adds a reference to its COM objects).
+    template <typename T>
+    struct ResourceHandle
+    {
+        static constexpr uint32_t INDEX_BITS = 20u;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1u;
+        static constexpr uint32_t GENERATION_MASK = (1u << (32u - INDEX_BITS)) - 1u;
+
+        uint32_t getIndex() const
+        {
+            return value & INDEX_MASK;
+        }
+
+        uint32_t getGeneration() const
+        {
+            return value >> INDEX_BITS;
+        }
+
+        // Null handles do not refer to any resource.
+        bool isNull() const
+        {
+            return value == INVALID_INDEX_U32;
+        }
+
+        bool operator==(const ResourceHandle& other) const = default;
+
+        uint32_t value{INVALID_INDEX_U32};
+    };
+
+    // Owns resources, each identified by a ResourceHandle, and looked up in O(1). Resources are stored in blocks of
+    // slots that are never moved, so that get can be called from any thread without a lock while other threads add
+    // and remove resources. Within a block, the generations and reference counts are stored in arrays separate from
+    // the resources (so that validating a handle does not touch the resource).
+    // Resources are reference counted, rather than handles : a resource is added with a single reference, holders
+    // that share it add a reference (tryAddReference), and the resource is removed from the pool along with the last
+    // reference (removeReference), which returns it so that the caller can release it (see
+    // GraphicsDevice::deferRelease). Adding and removing resources / references takes a lock.
+    // A generation wraps around after GENERATION_MASK removals from the same slot, after which a stale handle to the
+    // slot is no longer detected.
+    template <typename T>
+    class ResourcePool
+    {
+      public:
+        using Handle = ResourceHandle<T>;
+
+        static constexpr uint32_t BLOCK_SIZE = 1024u;
+
+        // The last index is never used, so that no handle is equal to the null handle.
+        static constexpr uint32_t MAX_RESOURCE_COUNT = Handle::INDEX_MASK;
+
+        ResourcePool() = default;
+
+        ResourcePool(const ResourcePool& other) = delete;
+        ResourcePool& operator=(const ResourcePool& other) = delete;
+
+        ResourcePool(ResourcePool&& other) = delete;
+        ResourcePool& operator=(ResourcePool&& other) = delete;
+
+        [[nodiscard]] Handle add(T&& resource)
+        {
+            const std::scoped_lock lock(m_mutex);
+
+            uint32_t index{};
+            if (!m_freeIndices.empty())
+            {
+                index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+            }
+            else
+            {
+                if (m_slotCount == MAX_RESOURCE_COUNT)
+                {
+                    fatalError("Resource pool is full");
+                }
+
+                index = m_slotCount++;
+
+                if (!m_blocks[index / BLOCK_SIZE])
+                {
+                    m_blocks[index / BLOCK_SIZE] = std::make_unique<Block>();
+                }
+            }
+
+            Block& block = *m_blocks[index / BLOCK_SIZE];
+            const uint32_t slot = index % BLOCK_SIZE;
+
+            block.resources[slot] = std::move(resource);
+            block.referenceCounts[slot] = 1u;
+
+            return Handle{
+                .value = (block.generations[slot].load(std::memory_order_relaxed) << Handle::INDEX_BITS) | index,
+            };
+        }
+
+        // Returns nullptr for null and stale handles. The caller must hold a reference to the resource (or otherwise
+        // know that it is not removed during the call).
+        [[nodiscard]] T* get(const Handle handle) const
+        {
+            if (!isValid(handle))
+            {
+                return nullptr;
+            }
+
+            Block& block = *m_blocks[handle.getIndex() / BLOCK_SIZE];
+            return &block.resources[handle.getIndex() % BLOCK_SIZE].value();
+        }
+
+        [[nodiscard]] bool isValid(const Handle handle) const
+        {
+            if (handle.isNull() || handle.getIndex() >= MAX_RESOURCE_COUNT)
+            {
+                return false;
+            }
+
+            const Block* const block = m_blocks[handle.getIndex() / BLOCK_SIZE].get();
+
+            return block && block->generations[handle.getIndex() % BLOCK_SIZE].load(std::memory_order_acquire) ==
+                                handle.getGeneration();
+        }
+
+        // Fails if the handle is stale (i.e the last reference has been removed).
+        [[nodiscard]] bool tryAddReference(const Handle handle)
+        {
+            const std::scoped_lock lock(m_mutex);
+
+            if (!isValid(handle))
+            {
+                return false;
+            }
+
+            ++m_blocks[handle.getIndex() / BLOCK_SIZE]->referenceCounts[handle.getIndex() % BLOCK_SIZE];
+            return true;
+        }
+
+        // Returns the resource if this was its last reference (in which case the handle becomes stale).
+        [[nodiscard]] std::optional<T> removeReference(const Handle handle)
+        {
+            const std::scoped_lock lock(m_mutex);
+
+            if (!isValid(handle))
+            {
+                return std::nullopt;
+            }
+
+            Block& block = *m_blocks[handle.getIndex() / BLOCK_SIZE];
+            const uint32_t slot = handle.getIndex() % BLOCK_SIZE;
+
+            if (--block.referenceCounts[slot] != 0u)
+            {
+                return std::nullopt;
+            }
+
+            std::optional<T> resource = std::move(block.resources[slot]);
+            block.resources[slot].reset();
+
+            block.generations[slot].store((handle.getGeneration() + 1u) & Handle::GENERATION_MASK,
+                                          std::memory_order_release);
+            m_freeIndices.emplace_back(handle.getIndex());
+
+            return resource;
+        }
+
+        uint32_t getResourceCount() const
+        {
+            const std::scoped_lock lock(m_mutex);
+
+            return m_slotCount - static_cast<uint32_t>(m_freeIndices.size());
+        }
+
+      private:
+        struct Block
+        {
+            std::array<std::atomic<uint32_t>, BLOCK_SIZE> generations{};
+            std::array<uint32_t, BLOCK_SIZE> referenceCounts{};
+            std::array<std::optional<T>, BLOCK_SIZE> resources{};
+        };
+
+      private:
+        std::array<std::unique_ptr<Block>, (MAX_RESOURCE_COUNT + BLOCK_SIZE) / BLOCK_SIZE> m_blocks{};
+        uint32_t m_slotCount{};
+        std::vector<uint32_t> m_freeIndices{};
+
+        mutable std::mutex m_mutex{};
+    };
+
+    using TextureHandle = ResourceHandle<Texture>;
+    using TexturePool = ResourcePool<Texture>;
+} // namespace helios::gfx
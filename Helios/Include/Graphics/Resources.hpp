@@ -103,11 +103,14 @@ namespace helios::gfx
     // Buffer related functions / enum's.
     // Vertex buffer's are not used in the engine. Rather vertex pulling is used and data is stored in structured
     // buffer.
+    // Dynamic structured buffers are placed in CPU visible memory (like constant buffers), and are written by the CPU
+    // through the mapped pointer.
     enum class BufferUsage
     {
         UploadBuffer,
         IndexBuffer,
         StructuredBuffer,
+        DynamicStructuredBuffer,
         ConstantBuffer,
     };
 
@@ -117,6 +120,13 @@ namespace helios::gfx
         std::wstring_view name{};
     };
 
+    // Identifies the batch of copies (see UploadRingBuffer) that uploads the data of a resource. A default constructed
+    // ticket is always complete (i.e the resource had no data to upload).
+    struct UploadTicket
+    {
+        uint64_t batchIndex{};
+    };
+
     struct Buffer
     {
         // To be used primarily for constant buffers.
@@ -125,9 +135,24 @@ namespace helios::gfx
         Allocation allocation{};
         size_t sizeInBytes{};
 
+        // Size of a single element of the buffer. Used to determine the format of index buffers (16 / 32 bit).
+        uint32_t stride{};
+
         uint32_t srvIndex{INVALID_INDEX_U32};
         uint32_t uavIndex{INVALID_INDEX_U32};
         uint32_t cbvIndex{INVALID_INDEX_U32};
+
+        // The buffer can be used on the direct and compute queues right away (see GraphicsDevice::flushUploads), but
+        // the ticket can be used to check if (or wait until) its data is on the GPU.
+        UploadTicket uploadTicket{};
+    };
+
+    // Constant data that is only valid for the frame it was allocated in (see FrameConstantAllocator). Used for the
+    // constants that change every frame, which are never written while a frame in flight may read them.
+    struct FrameConstantBuffer
+    {
+        uint32_t cbvIndex{INVALID_INDEX_U32};
+        D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddress{};
     };
 
     // Needs to passed to the memory allocator's create buffer function along with a buffer creation desc struct.
@@ -160,7 +185,8 @@ namespace helios::gfx
     // function. Similarly, Render Targets will also be of type Texture. TextureUpload is used for intermediate buffers
     // (as used in UpdateSubresources). If data is already loaded elsewhere, use the TextureFromData enum (this requires
     // TextureCreateionDesc has all properties correctly set (specifically dimensions). UAV Texture is just a regular
-    // texture with flags to allow it to be used as a UAV.
+    // texture with flags to allow it to be used as a UAV. TextureFromContainer loads a DDS file (see DDSFile) : the
+    // format, dimensions and all mip levels are taken from the file, so no mips are generated on the GPU.
     // note(rtarun9) : These usages correspond more with how textures are being created then how they are being used,
     // consider changing this in the future.
     enum class TextureUsage
@@ -170,6 +196,7 @@ namespace helios::gfx
         TextureFromPath,
         TextureFromData,
         HDRTextureFromPath,
+        TextureFromContainer,
         CubeMap,
         UAVTexture
     };
@@ -186,6 +213,14 @@ namespace helios::gfx
         uint32_t bytesPerPixel{4u};
         std::wstring_view name{};
         std::wstring path{};
+
+        // TextureFromContainer only : the first mip level of the container that is loaded. The texture is created with
+        // the dimensions of that level and the remaining levels of the chain (used for texture streaming, see
+        // TextureStreamer).
+        uint32_t mostDetailedMip{0u};
+
+        // If valid, the SRV is written to this index of the descriptor heap instead of a newly allocated descriptor.
+        uint32_t srvIndex{INVALID_INDEX_U32};
     };
 
     struct Texture
@@ -199,8 +234,23 @@ namespace helios::gfx
         uint32_t dsvIndex{INVALID_INDEX_U32};
         uint32_t rtvIndex{INVALID_INDEX_U32};
 
+        // Number of contiguous SRV's / UAV's starting at srvIndex / uavIndex that are owned by the texture (and
+        // released along with it, see GraphicsDevice::deferRelease).
+        uint32_t srvCount{};
+        uint32_t uavCount{};
+
+        // See Buffer::uploadTicket.
+        UploadTicket uploadTicket{};
+
         static bool isTextureSRGB(const DXGI_FORMAT format);
         static DXGI_FORMAT getNonSRGBFormat(const DXGI_FORMAT format);
+
+        // Block compressed formats store 4x4 pixel blocks. The top level dimensions of such textures must be a multiple
+        // of 4, and can not be used as UAV's.
+        static bool isBlockCompressed(const DXGI_FORMAT format);
+
+        // Size in bytes of a 4x4 block (block compressed formats) or of a single pixel (all other formats).
+        static uint32_t getBytesPerBlock(const DXGI_FORMAT format);
     };
 
     struct Sampler
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "DDSFile.hpp"
+#include "ResourcePool.hpp"
+
+namespace helios::gfx
+{
+    class GraphicsDevice;
+
+    struct TextureStreamingSettings
+    {
+        // Upper bound on the video memory used by the streamed textures. The effective budget is further limited by
+        // the video memory budget the OS gives the process (see GraphicsDevice::getVideoMemoryBudget).
+        uint64_t budgetBytes{1024ull * 1024ull * 1024ull};
+
+        // Added to the mip level requested for each texture (positive values stream in less detailed mips).
+        float mipBias{0.0f};
+
+        // Number of textures whose residency can change per frame. Each change uploads the resident mips of the
+        // texture, so this bounds the time spent streaming in a single frame.
+        uint32_t maxResidencyChangesPerFrame{4u};
+    };
+
+    // The device abstraction will have an object of this type.
+    // Streams the mip levels of textures loaded from containers (see DDSFile) based on the mip levels requested for
+    // them each frame. Only the tail of the mip chain (the mips that are at most TAIL_MIP_DIMENSION texels in size) is
+    // loaded when a texture is registered, and more detailed mips are streamed in as they are requested. When the
+    // requested mips do not fit in the budget, the least detailed mip of the largest textures is dropped first.
+    // A texture with a different set of resident mips is a new allocation with the dimensions of its most detailed
+    // resident mip (so the unused mips take no video memory), which is created from the memory mapped container. Each
+    // streamed texture alternates between two SRV's : the view of the new allocation is written to the SRV that no
+    // frame in flight uses, and the previous allocation is released once all frames that may use it have completed
+    // (see GraphicsDevice::deferRelease).
+    // Streamed textures are owned by the texture pool of the device (see GraphicsDevice::getTexturePool), and the
+    // streamer only holds their handles : a texture whose handle is stale has been destroyed.
+    // The Texture object is updated in place, so its SRV index is always the view of the resident mips (copies of the
+    // index, such as in the material table, are refreshed when getResidencyChangeCount changes).
+    // Requests are made from the main thread (between frames), while textures can be registered by any thread.
+    class TextureStreamer
+    {
+      public:
+        static constexpr uint32_t TAIL_MIP_DIMENSION = 64u;
+
+        explicit TextureStreamer(const GraphicsDevice* const graphicsDevice);
+
+        // The texture (in the texture pool) must have been created from the container at containerPath, with
+        // TAIL_MIP_DIMENSION sized mips resident (see getTailMip).
+        void registerTexture(const TextureHandle textureHandle, const std::wstring_view containerPath,
+                             const DDSTextureDesc& textureDesc, const std::wstring_view name);
+
+        // The least detailed mip that can be the most detailed resident mip of a texture. Block compressed textures
+        // must have dimensions that are a multiple of 4, so their tail may start at a more detailed mip.
+        [[nodiscard]] static uint32_t getTailMip(const DDSTextureDesc& textureDesc);
+
+        // textureCoordsPerPixel is the number of texture coordinate units covered by a pixel : the requested mip is
+        // log2 of the number of texels per pixel. A texture can be requested multiple times in a frame (the most
+        // detailed request is used). Textures that are not streamed are ignored, and textures that are not requested
+        // in a frame only keep their tail mips resident.
+        void requestMip(const TextureHandle textureHandle, const float textureCoordsPerPixel);
+
+        // To be called once per frame after the requests of the frame have been made (and before the textures are
+        // used for rendering).
+        void update();
+
+        uint64_t getResidentBytes() const
+        {
+            return m_residentBytes;
+        }
+
+        uint32_t getStreamedTextureCount() const
+        {
+            return static_cast<uint32_t>(m_streamedTextures.size());
+        }
+
+        // Incremented each time the resident mips (and hence the SRV index) of a texture change. Used to detect when
+        // SRV indices copied elsewhere (such as into the material table) have to be refreshed.
+        uint64_t getResidencyChangeCount() const
+        {
+            return m_residencyChangeCount;
+        }
+
+      private:
+        struct StreamedTexture
+        {
+            TextureHandle textureHandle{};
+
+            std::wstring containerPath{};
+            std::wstring name{};
+
+            DDSTextureDesc textureDesc{};
+            uint32_t tailMip{};
+
+            // Size (in bytes) of the mip chain starting at each mip level.
+            std::vector<uint64_t> mipChainSizes{};
+
+            uint32_t residentMip{};
+            uint32_t desiredMip{};
+
+            // Most detailed mip level requested in the current frame (or FLT_MAX if the texture was not requested).
+            float requestedMip{std::numeric_limits<float>::max()};
+
+            // The SRV currently used by the texture is srvIndices[srvSlot], and is released along with the texture. The
+            // other SRV is released by the streamer once the texture is destroyed.
+            std::array<uint32_t, 2u> srvIndices{INVALID_INDEX_U32, INVALID_INDEX_U32};
+            uint32_t srvSlot{0u};
+
+            uint64_t lastResidencyChangeFrame{};
+        };
+
+        // Block compressed textures can only be created with dimensions that are a multiple of 4.
+        static bool isValidResidentMip(const DDSTextureDesc& textureDesc, const uint32_t mip);
+
+        // Computes the desired mip of each texture, dropping mips of the largest textures until they fit the budget.
+        // Returns the budget.
+        uint64_t computeDesiredMips();
+
+        void setResidentMip(StreamedTexture& streamedTexture, Texture& texture, const uint32_t mip);
+
+        // Releases the SRV that is not used by the (destroyed) texture.
+        void releaseInactiveSrv(const StreamedTexture& streamedTexture) const;
+
+      private:
+        const GraphicsDevice& m_graphicsDevice;
+
+        std::vector<StreamedTexture> m_streamedTextures{};
+
+        // Keyed by the index of the texture handle (a slot of the pool holds at most one texture at a time).
+        std::unordered_map<uint32_t, size_t> m_streamedTextureIndices{};
+
+        uint64_t m_residentBytes{};
+        uint64_t m_frame{};
+        uint64_t m_residencyChangeCount{};
+
+        std::mutex m_mutex{};
+
+      public:
+        TextureStreamingSettings m_settings{};
+    };
+} // namespace helios::gfx
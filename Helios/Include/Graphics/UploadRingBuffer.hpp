@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CopyContext.hpp"
+#include "Resources.hpp"
+
+namespace helios::gfx
+{
+    class CommandQueue;
+    class GraphicsDevice;
+    class MemoryAllocator;
+
+    // The device abstraction will have an object of this type.
+    // All data uploaded to GPU only resources (buffers and textures) is staged in a single persistently mapped upload
+    // buffer, which is sub allocated as a ring : each upload takes the bytes after the previous one, and the bytes are
+    // reclaimed once the copy queue has executed the batch of copies that read them. The copies are recorded into a
+    // shared copy context and submitted as a batch, either once SUBMISSION_THRESHOLD bytes are pending, when the ring
+    // is full, or when submit is called explicitly (see GraphicsDevice::flushUploads). Uploads larger than the ring use
+    // a dedicated upload buffer, which is released along with the batch that reads it.
+    // The resources are only valid on other queues once they have waited for the fence value returned by submit.
+    // Each upload returns a ticket (the index of the batch it belongs to), which can be polled or waited on by the CPU.
+    class UploadRingBuffer
+    {
+      public:
+        static constexpr uint64_t CAPACITY = 128ull * 1024ull * 1024ull;
+        static constexpr uint64_t SUBMISSION_THRESHOLD = 32ull * 1024ull * 1024ull;
+
+        explicit UploadRingBuffer(GraphicsDevice* const graphicsDevice, MemoryAllocator* const memoryAllocator,
+                                  CommandQueue* const copyCommandQueue);
+        ~UploadRingBuffer();
+
+        UploadRingBuffer(const UploadRingBuffer& other) = delete;
+        UploadRingBuffer& operator=(const UploadRingBuffer& other) = delete;
+
+        UploadRingBuffer(UploadRingBuffer&& other) = delete;
+        UploadRingBuffer& operator=(UploadRingBuffer&& other) = delete;
+
+        // The data is copied into the ring before the functions return, so it can be released right after.
+        [[nodiscard]] UploadTicket uploadBuffer(ID3D12Resource* const destinationResource, const void* data,
+                                                const uint64_t sizeInBytes);
+        [[nodiscard]] UploadTicket uploadTexture(ID3D12Resource* const destinationResource,
+                                                 const std::span<const D3D12_SUBRESOURCE_DATA> subresourceData);
+
+        // Submits the pending copies (if any). Returns the copy queue fence value that is signaled once all uploads
+        // made so far have completed.
+        uint64_t submit();
+
+        // Ticket of the most recent upload (which completes after all previous uploads).
+        [[nodiscard]] UploadTicket getLatestUploadTicket();
+
+        // Does not submit the batch of the ticket, so a pending batch is only complete once it has been submitted
+        // (which happens at least once per frame).
+        [[nodiscard]] bool isUploadComplete(const UploadTicket& uploadTicket);
+
+        // Submits the batch of the ticket (if it is pending), and blocks until it has been executed.
+        void waitForUpload(const UploadTicket& uploadTicket);
+
+      private:
+        struct UploadRegion
+        {
+            std::byte* cpuAddress{};
+            ID3D12Resource* resource{};
+            uint64_t offset{};
+        };
+
+        // Copies that have been submitted, but may not have been executed yet.
+        struct Batch
+        {
+            uint64_t batchIndex{};
+
+            std::unique_ptr<CopyContext> copyContext{};
+            uint64_t fenceValue{};
+
+            // Bytes of the ring used by the batch (including the padding for alignment / wrapping around).
+            uint64_t sizeInBytes{};
+            std::vector<Allocation> dedicatedAllocations{};
+        };
+
+        // The functions below expect m_mutex to be locked.
+        [[nodiscard]] UploadRegion allocate(const uint64_t sizeInBytes, const uint64_t alignment);
+        [[nodiscard]] CopyContext* getRecordingCopyContext();
+        uint64_t submitBatch();
+        void retireCompletedBatches();
+        [[nodiscard]] UploadTicket onUploadRecorded(const uint64_t sizeInBytes);
+
+      private:
+        GraphicsDevice& m_graphicsDevice;
+        MemoryAllocator& m_memoryAllocator;
+        CommandQueue& m_copyCommandQueue;
+
+        Allocation m_ringAllocation{};
+        std::byte* m_ringCpuAddress{};
+
+        uint64_t m_head{};
+        uint64_t m_usedBytes{};
+
+        // State of the batch that is being recorded.
+        std::unique_ptr<CopyContext> m_copyContext{};
+        uint64_t m_pendingRingBytes{};
+        uint64_t m_pendingUploadBytes{};
+        std::vector<Allocation> m_pendingDedicatedAllocations{};
+
+        std::deque<Batch> m_batches{};
+        std::vector<std::unique_ptr<CopyContext>> m_freeCopyContexts{};
+
+        uint64_t m_lastSubmittedFenceValue{};
+
+        // Batch indices start at 1 (so that a default constructed UploadTicket is complete). The batch being recorded
+        // has the index m_submittedBatchCount + 1.
+        uint64_t m_submittedBatchCount{};
+        uint64_t m_retiredBatchCount{};
+
+        std::mutex m_mutex{};
+    };
+} // namespace helios::gfx
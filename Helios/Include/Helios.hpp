@@ -2,18 +2,27 @@
 
 #include "Core/Application.hpp"
 #include "Core/Input.hpp"
+#include "Core/JobSystem.hpp"
 #include "Core/FileSystem.hpp"
+#include "Core/ImageDecoder.hpp"
+#include "Core/MemoryMappedFile.hpp"
 
 #include "Graphics/CommandQueue.hpp"
 #include "Graphics/Context.hpp"
 #include "Graphics/CopyContext.hpp"
+#include "Graphics/DDSFile.hpp"
+#include "Graphics/DescriptorAllocator.hpp"
 #include "Graphics/DescriptorHeap.hpp"
+#include "Graphics/FrameConstantAllocator.hpp"
 #include "Graphics/GraphicsContext.hpp"
 #include "Graphics/GraphicsDevice.hpp"
 #include "Graphics/MemoryAllocator.hpp"
 #include "Graphics/PipelineState.hpp"
+#include "Graphics/ResourcePool.hpp"
 #include "Graphics/Resources.hpp"
 #include "Graphics/ShaderCompiler.hpp"
+#include "Graphics/TextureStreamer.hpp"
+#include "Graphics/UploadRingBuffer.hpp"
 #include "Graphics/d3dx12.hpp"
 
 #include "Rendering/DeferredGeometryPass.hpp"
@@ -22,12 +31,23 @@
 #include "Rendering/SSAOPass.hpp"
 #include "Rendering/BloomPass.hpp"
 
+#include "Scene/AccessorDecoder.hpp"
 #include "Scene/Camera.hpp"
+#include "Scene/MaterialTable.hpp"
 #include "Scene/Materials.hpp"
 #include "Scene/Mesh.hpp"
+#include "Scene/MeshCache.hpp"
+#include "Scene/MeshOptimizer.hpp"
+#include "Scene/VertexQuantization.hpp"
+#include "Scene/MeshletBuilder.hpp"
+#include "Scene/MipChainBuilder.hpp"
+#include "Scene/MeshSimplifier.hpp"
 #include "Scene/Model.hpp"
 #include "Scene/Lights.hpp"
 #include "Scene/Scene.hpp"
+#include "Scene/TextureCache.hpp"
+#include "Scene/TextureCompressor.hpp"
+#include "Scene/TransformStore.hpp"
 
 #include "ShaderInterlop/ConstantBuffers.hlsli"
 #include "ShaderInterlop/RenderResources.hlsli"
\ No newline at end of file
@@ -2,17 +2,27 @@
 
 // STL includes.
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <format>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <source_location>
 #include <random>
 #include <span>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <future>
 #include <queue>
 #include <vector>
@@ -35,7 +35,7 @@ namespace helios::rendering
         gfx::Texture m_extractionTexture{};
         gfx::PipelineState m_extractionPipelineState{};
 
-        gfx::Buffer m_bloomBuffer{};
+        gfx::FrameConstantBuffer m_bloomBuffer{};
         interlop::BloomBuffer m_bloomBufferData{};
     };
 } // namespace helios::rendering
\ No newline at end of file
@@ -35,7 +35,7 @@ namespace helios::rendering
         gfx::PipelineState m_shadowPassPipelineState{};
         gfx::Texture m_shadowDepthBuffer{};
 
-        gfx::Buffer m_shadowBuffer{};
+        gfx::FrameConstantBuffer m_shadowBuffer{};
         interlop::ShadowBuffer m_shadowBufferData{};
     };
 } // namespace helios::rendering
\ No newline at end of file
@@ -24,7 +24,7 @@ namespace helios::rendering
 
       public:
         interlop::SSAOBuffer m_ssaoBufferData{};
-        gfx::Buffer m_ssaoBuffer{};
+        gfx::FrameConstantBuffer m_ssaoBuffer{};
 
         gfx::Texture m_randomRotationTexture{};
 
@@ -0,0 +1,69 @@
+#pragma once
+
+namespace helios::scene
+{
+    // Component types of a accessor. Values match the glTF specification (and hence the TINYGLTF_COMPONENT_TYPE_*
+    // defines), so they can be cast directly.
+    enum class AccessorComponentType : uint32_t
+    {
+        Int8 = 5120u,
+        UInt8 = 5121u,
+        Int16 = 5122u,
+        UInt16 = 5123u,
+        UInt32 = 5125u,
+        Float = 5126u,
+    };
+
+    // Sparse storage of a accessor : 'count' elements of the accessor (given by 'indices') are replaced by the tightly
+    // packed elements in 'values'.
+    struct SparseAccessorDesc
+    {
+        uint32_t count{};
+
+        const std::byte* indices{};
+        AccessorComponentType indexComponentType{AccessorComponentType::UInt32};
+
+        const std::byte* values{};
+    };
+
+    // Description of a glTF accessor that is independent of tinygltf. If data is nullptr, all elements are zero (which
+    // is valid for sparse accessors without a buffer view).
+    struct AccessorDesc
+    {
+        const std::byte* data{};
+        uint32_t count{};
+
+        uint32_t componentCount{1u};
+        AccessorComponentType componentType{AccessorComponentType::Float};
+
+        // If 0, elements are assumed to be tightly packed.
+        uint32_t byteStride{};
+        bool normalized{false};
+
+        SparseAccessorDesc sparse{};
+    };
+
+    // All accessor decoding functions use SSE2 / AVX2 (selected at runtime based on CPU support) fast paths for the
+    // common cases (float streams, 16 / 32 bit indices and normalized integers), and fall back to a scalar path for
+    // everything else.
+
+    [[nodiscard]] uint32_t getComponentSize(const AccessorComponentType componentType);
+
+    // Decodes the accessor into tightly packed floats (outputComponentCount floats per element). Integer components
+    // are converted using the glTF rules for normalized integers if accessor.normalized is true, extra components are
+    // dropped and missing components are set to zero. output.size() must be >= accessor.count * outputComponentCount.
+    void decodeFloatAccessor(const AccessorDesc& accessor, std::span<float> output,
+                             const uint32_t outputComponentCount);
+
+    [[nodiscard]] std::vector<math::XMFLOAT3> decodeFloat3Accessor(const AccessorDesc& accessor);
+    [[nodiscard]] std::vector<math::XMFLOAT2> decodeFloat2Accessor(const AccessorDesc& accessor);
+
+    // Decodes a index accessor. If all indices fit into 16 bits (i.e vertexCount <= 65536, or the source indices are
+    // 8 / 16 bit), indices are stored as uint16_t, else as uint32_t. Returns the stride of the decoded indices.
+    uint32_t decodeIndexAccessor(const AccessorDesc& accessor, const uint32_t vertexCount,
+                                 std::vector<std::byte>& indices);
+
+    // Conversion between 16 and 32 bit indices. When narrowing, all input indices must fit into 16 bits.
+    void widenIndices(std::span<const uint16_t> input, std::span<uint32_t> output);
+    void narrowIndices(std::span<const uint32_t> input, std::span<uint16_t> output);
+} // namespace helios::scene
@@ -38,7 +38,8 @@ namespace helios::scene
         explicit Lights(const gfx::GraphicsDevice* const graphicsDevice);
         
         // Update light buffer and update the model matrices (to be used in the Instanced rendering buffer).
-        void update(const math::XMMATRIX viewMatrix);
+        // Both buffers are frame constants (see gfx::FrameConstantAllocator), so this is called once per frame.
+        void update(const gfx::GraphicsDevice* const graphicsDevice, const math::XMMATRIX viewMatrix);
 
         // Render all visualizable lights in a instanced rendering fashion.
         void render(const gfx::GraphicsContext* graphicsContext, interlop::LightRenderResources& lightRenderResources);
@@ -49,11 +50,11 @@ namespace helios::scene
       public:
         // Store light positions, color, intensities, etc.
         interlop::LightBuffer m_lightsBufferData{};
-        gfx::Buffer m_lightsBuffer{};
+        gfx::FrameConstantBuffer m_lightsBuffer{};
 
         // Store the model matrices required for instanced rendering.
         interlop::LightInstancedRenderingBuffer m_lightsInstancedBufferData{};
-        gfx::Buffer m_lightsInstanceBuffer{};
+        gfx::FrameConstantBuffer m_lightsInstanceBuffer{};
 
         // All lights (point) will use a same mesh.
         // However, note that each light has its own model matrices, as instanced rendering will be used for light
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Graphics/Resources.hpp"
+
+#include "ShaderInterlop/ConstantBuffers.hlsli"
+
+namespace helios::gfx
+{
+    class GraphicsDevice;
+}
+
+namespace helios::scene
+{
+    // Stores the material data of all models of a scene in a single table, each material identified by its index in
+    // the table (see PBRMaterial::materialIndex). On the GPU, the table is a structured buffer of
+    // interlop::MaterialData that shaders index with the material index of the draw.
+    // Materials rarely change (only when edited), so only materials that were set since the last update are written :
+    // the per frame cost is proportional to the number of changed materials, not to the number of materials. As with
+    // the TransformStore, the table is in CPU visible memory and there is one per frame in flight, so a changed
+    // material is written to each of them as its frame comes up.
+    // Materials can be added from any thread (as models are loaded asynchronously), but they are only valid once the
+    // update (or addPendingMaterials) that follows the add has run. All other functions are to be called from the main
+    // thread.
+    class MaterialTable
+    {
+      public:
+        explicit MaterialTable(const gfx::GraphicsDevice* const graphicsDevice);
+
+        [[nodiscard]] uint32_t addMaterial(const interlop::MaterialData& materialData);
+
+        const interlop::MaterialData& getMaterial(const uint32_t materialIndex) const
+        {
+            return m_materials[materialIndex];
+        }
+
+        void setMaterial(const uint32_t materialIndex, const interlop::MaterialData& materialData);
+
+        // Makes the materials added (by any thread) since the last call valid. Called by update, but can be called
+        // before it to get / set the added materials in the same frame.
+        void addPendingMaterials();
+
+        // Adds the materials added since the last update, and writes the changed materials to the table of the current
+        // frame in flight. To be called once per frame, before the models are rendered.
+        void update(const gfx::GraphicsDevice* const graphicsDevice);
+
+        // SRV of the table written by the last update.
+        uint32_t getSrvIndex() const
+        {
+            return m_buffers[m_currentBufferIndex].srvIndex;
+        }
+
+        uint32_t getMaterialCount() const
+        {
+            return static_cast<uint32_t>(m_materials.size());
+        }
+
+      private:
+        // Marks the material to be written to all tables, starting with the next update.
+        void markPendingWrite(const uint32_t materialIndex);
+
+        // Recreates the tables with space for at least materialCount materials.
+        void growBuffers(const gfx::GraphicsDevice* const graphicsDevice, const uint32_t materialCount);
+
+      private:
+        std::vector<interlop::MaterialData> m_materials{};
+
+        // Materials that have not been written to all tables since they last changed. m_changeUpdates holds the update
+        // (m_updateCount) in which each material is first written after its last change, and m_bufferUpdates the
+        // update in which each table was last written.
+        std::vector<uint64_t> m_changeUpdates{};
+        std::vector<uint8_t> m_isPendingWrite{};
+        std::vector<uint32_t> m_pendingWriteIndices{};
+
+        std::vector<gfx::Buffer> m_buffers{};
+        std::vector<uint64_t> m_bufferUpdates{};
+        uint32_t m_bufferCapacity{};
+        uint32_t m_currentBufferIndex{};
+
+        uint64_t m_updateCount{};
+
+        // Materials added (by any thread) since the last update. Indices are assigned when the material is added.
+        std::vector<interlop::MaterialData> m_addedMaterials{};
+        uint32_t m_addedMaterialCount{};
+        std::mutex m_addMutex{};
+    };
+} // namespace helios::scene
@@ -1,39 +1,50 @@
 #pragma once
 
-#include "../Graphics/Resources.hpp"
+#include "../Graphics/ResourcePool.hpp"
 
 #include "ShaderInterlop/ConstantBuffers.hlsli"
 
 namespace helios::scene
 {
-    // This struct stores the texture's required for a PBR material. If a texture does not exist, the shader resource
-    // view index will be set to INVALID_INDEX_U32 (which is set by default in the sturct Texture). The shader will
+    // Textures are shared by all materials (and models) that use the same image (see TextureCache), so they are owned
+    // by the texture pool of the device, and materials hold a reference to them through their handle (see
+    // gfx::ResourcePool). A null handle means the material does not have that texture.
+
+    // Pixels with a lower albedo alpha are discarded by the deferred geometry pass (see DeferredGeometryPass.hlsl).
+    static constexpr float ALPHA_TEST_CUTOFF = 0.9f;
+
+    // Returns INVALID_INDEX_U32 for null handles.
+    inline uint32_t getSrvIndex(const gfx::TexturePool* const texturePool, const gfx::TextureHandle textureHandle)
+    {
+        const gfx::Texture* const texture = texturePool->get(textureHandle);
+
+        return texture ? texture->srvIndex : INVALID_INDEX_U32;
+    }
+
+    // This struct stores the texture's required for a PBR material. If a texture does not exist, the handle is null and
+    // the shader resource view index passed to the shader will be INVALID_INDEX_U32 (see getSrvIndex). The shader will
     // accordingly set a null view or not use that particular texture. Each texture (if it exist) will have a sampler
     // index associated with it, so we can use SamplerDescriptorHeap to index into the heap directly. The same applies
     // for samplers.
     struct PBRMaterial
     {
-        gfx::Texture albedoTexture{};
+        gfx::TextureHandle albedoTexture{};
         gfx::Sampler albedoTextureSampler{};
 
-        gfx::Texture normalTexture{};
+        gfx::TextureHandle normalTexture{};
         gfx::Sampler normalTextureSampler{};
 
-        gfx::Texture metalRoughnessTexture{};
+        gfx::TextureHandle metalRoughnessTexture{};
         gfx::Sampler metalRoughnessTextureSampler{};
 
-        gfx::Texture aoTexture{};
+        gfx::TextureHandle aoTexture{};
         gfx::Sampler aoTextureSampler{};
 
-        gfx::Texture emissiveTexture{};
+        gfx::TextureHandle emissiveTexture{};
         gfx::Sampler emissiveTextureSampler{};
 
-        // Note : By using the values in this buffer, the PBR renderer will most likely 'break' and become physically
-        // inaccurate.
-        // These are used for debugging and testing purposes only.
-        gfx::Buffer materialBuffer{};
-        interlop::MaterialBuffer materialBufferData{};
-        
-        uint32_t materialIndex{};
+        // Index of the material data (roughness / metallic / emissive factors and albedo color) in the material table
+        // of the scene (see MaterialTable). INVALID_INDEX_U32 for models created without a material table.
+        uint32_t materialIndex{INVALID_INDEX_U32};
     };
 } // namespace helios::scene
\ No newline at end of file
@@ -2,8 +2,22 @@
 
 #include "../Graphics/Resources.hpp"
 
+#include "MeshCache.hpp"
+
 namespace helios::scene
 {
+    // GPU side meshlet data of a mesh (see MeshletBuilder for the layout of each buffer). All buffers are structured
+    // buffers, and meshletCount is 0 if the model was cooked without meshlets.
+    struct MeshletBuffers
+    {
+        gfx::Buffer meshletBuffer{};
+        gfx::Buffer meshletBoundsBuffer{};
+        gfx::Buffer meshletVertexBuffer{};
+        gfx::Buffer meshletTriangleBuffer{};
+
+        uint32_t meshletCount{};
+    };
+
     // Stores all mesh data.
     struct Mesh
     {
@@ -13,6 +27,23 @@ namespace helios::scene
 
         gfx::Buffer indexBuffer{};
 
+        // Index buffer with the indices of all LOD's (see MeshLod::indexOffset). LOD 0 uses indexBuffer.
+        gfx::Buffer lodIndexBuffer{};
+        std::vector<MeshLod> lods{};
+
+        // Object space bounding sphere, used for LOD selection.
+        math::XMFLOAT3 boundingSphereCenter{};
+        float boundingSphereRadius{};
+
+        // Texture coord units per object space unit of length, used to request the mips of streamed textures.
+        float textureCoordDensity{};
+
+        // Constant buffer (interlop::MeshBuffer) with the data required to decode the (possibly quantized) vertex
+        // streams.
+        gfx::Buffer meshBuffer{};
+
+        MeshletBuffers meshlets{};
+
         uint32_t indicesCount{};
 
         uint32_t materialIndex{};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Core/MemoryMappedFile.hpp"
+#include "Scene/MeshletBuilder.hpp"
+
+namespace helios::scene
+{
+    // Order in which the textures of a material are stored (both in MaterialData and in the cooked mesh file).
+    enum class MaterialTextureType : uint8_t
+    {
+        Albedo,
+        Normal,
+        MetalRoughness,
+        AO,
+        Emissive,
+        Count
+    };
+
+    static constexpr size_t MATERIAL_TEXTURE_TYPE_COUNT = enumClassValue(MaterialTextureType::Count);
+
+    // CPU side description of a glTF sampler. The values are the raw glTF enums (-1 if not specified).
+    struct SamplerData
+    {
+        int32_t minFilter{-1};
+        int32_t magFilter{-1};
+        int32_t wrapS{-1};
+        int32_t wrapT{-1};
+    };
+
+    // CPU side description of a glTF material. Texture paths are relative to the model directory, and are empty if the
+    // material does not use that particular texture.
+    struct MaterialData
+    {
+        std::array<std::string, MATERIAL_TEXTURE_TYPE_COUNT> texturePaths{};
+        std::array<int32_t, MATERIAL_TEXTURE_TYPE_COUNT> samplerIndices{-1, -1, -1, -1, -1};
+
+        math::XMFLOAT4 baseColorFactor{1.0f, 1.0f, 1.0f, 1.0f};
+    };
+
+    // A simplified version of a mesh (see MeshSimplifier). LOD's share the vertex buffers of the mesh, and index into
+    // the LOD index buffer, which has the same index stride as the mesh index buffer.
+    struct MeshLod
+    {
+        uint32_t indexOffset{};
+        uint32_t indexCount{};
+
+        // Simplification error, in the same units as the positions of the mesh.
+        float error{};
+    };
+
+    // Non owning view of the vertex / index streams of a single primitive. Views either point into a MeshData (when the
+    // model was loaded from the glTF file) or directly into the memory mapped cooked mesh file.
+    struct MeshView
+    {
+        std::span<const math::XMFLOAT3> positions{};
+        std::span<const math::XMFLOAT3> normals{};
+        std::span<const math::XMFLOAT2> textureCoords{};
+
+        // Indices are either 16 or 32 bit (based on indexStride).
+        std::span<const std::byte> indices{};
+        uint32_t indexStride{sizeof(uint16_t)};
+
+        math::XMFLOAT3 minBounds{};
+        math::XMFLOAT3 maxBounds{};
+
+        uint32_t materialIndex{};
+
+        // Empty if the meshlets were not built (see MeshCookSettings::buildMeshlets).
+        MeshletView meshlets{};
+
+        // LOD 1 to N, from most to least detailed. Empty if no LOD's were generated (see MeshCookSettings::lodCount).
+        std::span<const MeshLod> lods{};
+        std::span<const std::byte> lodIndices{};
+    };
+
+    // CPU side data of a single primitive, as decoded from the glTF file.
+    struct MeshData
+    {
+        [[nodiscard]] MeshView getView() const;
+
+        uint32_t getIndexCount() const
+        {
+            return static_cast<uint32_t>(indices.size() / indexStride);
+        }
+
+        // Returns a copy of the index buffer with 32 bit indices (regardless of indexStride).
+        [[nodiscard]] std::vector<uint32_t> getIndicesUint32() const;
+
+        // Transforms the positions and normals (used to bake glTF node transforms into the vertex data). Triangle
+        // winding is flipped if the transform mirrors the mesh, so that front faces stay front facing.
+        void applyTransform(const math::XMMATRIX& transform);
+
+        // Computes the min / max bounds from the position stream.
+        void computeBounds();
+
+        std::vector<math::XMFLOAT3> positions{};
+        std::vector<math::XMFLOAT3> normals{};
+        std::vector<math::XMFLOAT2> textureCoords{};
+
+        // Indices are stored as 16 bit if possible, else 32 bit (see decodeIndexAccessor).
+        std::vector<std::byte> indices{};
+        uint32_t indexStride{sizeof(uint16_t)};
+
+        math::XMFLOAT3 minBounds{};
+        math::XMFLOAT3 maxBounds{};
+
+        uint32_t materialIndex{};
+
+        MeshletData meshlets{};
+
+        std::vector<MeshLod> lods{};
+        std::vector<std::byte> lodIndices{};
+    };
+
+    // Settings that change the cooked data. They are stored in the cooked mesh file, and a mismatch with the settings
+    // the model is loaded with causes the model to be re-cooked.
+    struct MeshCookSettings
+    {
+        // Vertex cache, overdraw and vertex fetch optimization (see MeshOptimizer).
+        bool optimizeMeshes{false};
+
+        // Split each primitive into meshlets and compute their culling bounds (see MeshletBuilder).
+        bool buildMeshlets{false};
+
+        // Number of LOD's per mesh, including the source mesh (see MeshSimplifier). Fewer LOD's may be generated if
+        // the mesh can not be simplified further.
+        uint32_t lodCount{1u};
+
+        bool operator==(const MeshCookSettings& other) const = default;
+    };
+
+    // Everything required to create a Model, independent of the source (glTF file or cooked mesh file).
+    struct ModelData
+    {
+        std::vector<MeshData> meshes{};
+        std::vector<MaterialData> materials{};
+        std::vector<SamplerData> samplers{};
+    };
+
+    // Reads and writes the cooked binary mesh format (.hmesh). A .hmesh file is written next to the source glTF file
+    // the first time a model is loaded, and stores the per primitive vertex / index streams (and optionally meshlets
+    // and LOD's), the material and sampler tables, the bounds of each primitive and a content hash of the source
+    // file(s). If the hash matches, the model is created straight from the memory mapped file : no JSON parsing, and no
+    // per vertex copies (stream data is handed off to the upload buffers directly).
+    // All stream data in the file is 16 byte aligned, and the layout is :
+    // [Header][Mesh table][Material table][Sampler table][String data][Streams...].
+    class MeshCache
+    {
+      public:
+        static constexpr uint32_t MAGIC = 0x48534D48u; // "HMSH".
+        static constexpr uint32_t VERSION = 5u;
+
+        // Returns the path of the cooked mesh file for the given model path (i.e Sponza.glb -> Sponza.hmesh).
+        [[nodiscard]] static std::wstring getCachePath(const std::wstring_view modelPath);
+
+        // Hashes the contents of the model file. For .gltf files, the .bin files in the model directory are hashed as
+        // well, as that is where the vertex / index data resides.
+        [[nodiscard]] static uint64_t computeSourceHash(const std::wstring_view modelPath);
+
+        // Writes the cooked mesh file. Failure to write the file is not fatal (it is only a cache), and is logged.
+        static void write(const std::wstring_view cachePath, const uint64_t sourceHash,
+                          const MeshCookSettings& cookSettings, const ModelData& modelData);
+
+        // Returns std::nullopt if the file does not exist, is corrupted, or was cooked from a different version of the
+        // source file / with different cook settings / with a different version of the format.
+        [[nodiscard]] static std::optional<MeshCache> open(const std::wstring_view cachePath, const uint64_t sourceHash,
+                                                           const MeshCookSettings& cookSettings);
+
+        std::span<const MeshView> getMeshes() const
+        {
+            return m_meshes;
+        }
+
+        std::span<const MaterialData> getMaterials() const
+        {
+            return m_materials;
+        }
+
+        std::span<const SamplerData> getSamplers() const
+        {
+            return m_samplers;
+        }
+
+      private:
+        MeshCache() = default;
+
+      private:
+        core::MemoryMappedFile m_file{};
+
+        std::vector<MeshView> m_meshes{};
+        std::vector<MaterialData> m_materials{};
+        std::vector<SamplerData> m_samplers{};
+    };
+} // namespace helios::scene
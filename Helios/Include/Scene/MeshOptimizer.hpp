@@ -0,0 +1,97 @@
+#pragma once
+
+namespace helios::scene
+{
+    struct MeshData;
+
+    // Result of simulating a FIFO post transform vertex cache over a index buffer.
+    // ACMR (average cache miss ratio) : vertex shader invocations per triangle (0.5 is optimal for large grids, 3 is
+    // the worst case).
+    // ATVR (average transformed vertex ratio) : vertex shader invocations per vertex (1.0 is optimal).
+    struct VertexCacheStatistics
+    {
+        uint32_t vertexTransformCount{};
+        uint32_t triangleCount{};
+        uint32_t vertexCount{};
+
+        float getACMR() const
+        {
+            return triangleCount == 0u ? 0.0f : static_cast<float>(vertexTransformCount) / triangleCount;
+        }
+
+        float getATVR() const
+        {
+            return vertexCount == 0u ? 0.0f : static_cast<float>(vertexTransformCount) / vertexCount;
+        }
+
+        VertexCacheStatistics& operator+=(const VertexCacheStatistics& other)
+        {
+            vertexTransformCount += other.vertexTransformCount;
+            triangleCount += other.triangleCount;
+            vertexCount += other.vertexCount;
+
+            return *this;
+        }
+    };
+
+    struct MeshOptimizationStatistics
+    {
+        VertexCacheStatistics beforeOptimization{};
+        VertexCacheStatistics afterOptimization{};
+    };
+
+    // CPU side mesh optimization functions. All functions operate on triangle lists with 32 bit indices, and do not
+    // depend on the GPU, so they can be run (and tested) in isolation.
+    class MeshOptimizer
+    {
+      public:
+        // Cache size used for the simulation and optimization. Most GPU's have a (effective) cache size in this range.
+        static constexpr uint32_t VERTEX_CACHE_SIZE = 16u;
+
+        // Threshold used by optimizeOverdraw : clusters are only split if the ACMR of the split cluster stays within
+        // this factor of the ACMR of the whole cluster.
+        static constexpr float OVERDRAW_ACMR_THRESHOLD = 1.05f;
+
+        [[nodiscard]] static VertexCacheStatistics analyzeVertexCache(std::span<const uint32_t> indices,
+                                                                      const uint32_t vertexCount,
+                                                                      const uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+        // Reorders triangles to improve post transform vertex cache hit rate.
+        // Reference : Fast Triangle Reordering for Vertex Locality and Reduced Overdraw (Sander, Nehab, Barczak), i.e
+        // Tipsify.
+        static void optimizeVertexCache(std::span<uint32_t> indices, const uint32_t vertexCount,
+                                        const uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+        // Reorders clusters of triangles (from a vertex cache optimized index buffer) so that triangles that face
+        // outwards of the mesh are drawn first, which reduces overdraw. Uses the same reference as above.
+        static void optimizeOverdraw(std::span<uint32_t> indices, std::span<const math::XMFLOAT3> positions,
+                                     const uint32_t cacheSize = VERTEX_CACHE_SIZE,
+                                     const float threshold = OVERDRAW_ACMR_THRESHOLD);
+
+        // Renumbers vertices in the order they are first referenced by the index buffer (so that vertex fetches are
+        // mostly sequential). Returns the remap table (old vertex index -> new vertex index, INVALID_INDEX_U32 for
+        // unreferenced vertices) to be used with remapVertexStream.
+        [[nodiscard]] static std::vector<uint32_t> optimizeVertexFetch(std::span<uint32_t> indices,
+                                                                       const uint32_t vertexCount);
+
+        template <typename T>
+        static void remapVertexStream(std::vector<T>& vertices, std::span<const uint32_t> remapTable,
+                                      const uint32_t newVertexCount)
+        {
+            std::vector<T> remappedVertices(newVertexCount);
+            for (const size_t i : std::views::iota(0u, vertices.size()))
+            {
+                if (remapTable[i] != INVALID_INDEX_U32)
+                {
+                    remappedVertices[remapTable[i]] = vertices[i];
+                }
+            }
+
+            vertices = std::move(remappedVertices);
+        }
+
+        // Runs all of the above on the mesh (vertex cache -> overdraw -> vertex fetch), and returns the vertex cache
+        // statistics before and after optimization.
+        static MeshOptimizationStatistics optimizeMesh(MeshData& meshData);
+    };
+} // namespace helios::scene
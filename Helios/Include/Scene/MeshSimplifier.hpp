@@ -0,0 +1,43 @@
+#pragma once
+
+namespace helios::scene
+{
+    struct MeshData;
+
+    struct SimplificationResult
+    {
+        std::vector<uint32_t> indices{};
+
+        // Largest distance (in the same units as the positions) between the simplified and the source surface, as
+        // estimated by the quadric error metric.
+        float error{};
+    };
+
+    // Quadric error metric based mesh simplification. Edges are collapsed onto one of their end points (no new
+    // vertices are created), so all LOD's of a mesh share the vertex buffers and only differ in their index buffers.
+    // Borders and attribute seams (vertices with the same position but different normals / texture coords) are
+    // preserved : border vertices may only collapse along the border, and seam vertices only along the seam.
+    // Like MeshOptimizer, all functions operate on triangle lists with 32 bit indices and do not depend on the GPU.
+    // Reference : Surface Simplification Using Quadric Error Metrics (Garland, Heckbert).
+    class MeshSimplifier
+    {
+      public:
+        // Every LOD targets this fraction of the index count of the previous LOD.
+        static constexpr float LOD_REDUCTION_RATIO = 0.5f;
+
+        // Generation of the LOD chain stops once simplification can not reduce the index count below this fraction of
+        // the previous LOD (i.e the mesh is mostly locked borders / seams).
+        static constexpr float MIN_LOD_REDUCTION_RATIO = 0.85f;
+
+        // Collapses edges (cheapest first) until the index count is at most targetIndexCount, or until the next
+        // collapse would exceed targetError (in the same units as the positions).
+        [[nodiscard]] static SimplificationResult simplify(std::span<const uint32_t> indices,
+                                                           std::span<const math::XMFLOAT3> positions,
+                                                           const uint32_t targetIndexCount,
+                                                           const float targetError = std::numeric_limits<float>::max());
+
+        // Fills in MeshData::lods and MeshData::lodIndices with up to (lodCount - 1) LOD's (LOD 0 being the source
+        // mesh). Each LOD is simplified from the previous one, and its error is the accumulated error of the chain.
+        static void generateLods(MeshData& meshData, const uint32_t lodCount);
+    };
+} // namespace helios::scene
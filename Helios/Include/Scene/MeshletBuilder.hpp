@@ -0,0 +1,84 @@
+#pragma once
+
+namespace helios::scene
+{
+    // A meshlet is a small cluster of triangles of a mesh. Vertices are referenced indirectly : meshletVertices stores
+    // the (mesh) vertex indices used by each meshlet, and meshletTriangles stores the triangles as local indices into
+    // that list (3 x 8 bits packed into a uint, see MeshletBuilder::packTriangle).
+    struct Meshlet
+    {
+        uint32_t vertexOffset{};
+        uint32_t triangleOffset{};
+        uint32_t vertexCount{};
+        uint32_t triangleCount{};
+    };
+
+    // Bounds used for culling a meshlet.
+    // The bounding sphere is used for frustum / occlusion culling. The normal cone (axis + cutoff) is used for back
+    // face culling of the entire cluster : the meshlet is back facing if
+    // dot(normalize(coneApex - cameraPosition), coneAxis) >= coneCutoff.
+    // If the normals are spread too much for the cone to be useful, coneCutoff is 1 (and the meshlet is never culled).
+    struct MeshletBounds
+    {
+        math::XMFLOAT3 center{};
+        float radius{};
+
+        math::XMFLOAT3 coneApex{};
+        float coneCutoff{1.0f};
+
+        math::XMFLOAT3 coneAxis{};
+        float padding{};
+    };
+
+    // CPU side meshlet data of a single mesh.
+    struct MeshletData
+    {
+        std::vector<Meshlet> meshlets{};
+        std::vector<MeshletBounds> bounds{};
+        std::vector<uint32_t> vertices{};
+        std::vector<uint32_t> triangles{};
+    };
+
+    // Non owning view of MeshletData (see MeshView).
+    struct MeshletView
+    {
+        std::span<const Meshlet> meshlets{};
+        std::span<const MeshletBounds> bounds{};
+        std::span<const uint32_t> vertices{};
+        std::span<const uint32_t> triangles{};
+    };
+
+    // Splits triangle lists (32 bit indices) into meshlets and computes their bounds. Does not depend on the GPU, so it
+    // can be run (and tested) in isolation.
+    class MeshletBuilder
+    {
+      public:
+        // Limits that map well to mesh shader thread groups (and are the values recommended by most IHV's).
+        static constexpr uint32_t MAX_MESHLET_VERTICES = 64u;
+        static constexpr uint32_t MAX_MESHLET_TRIANGLES = 124u;
+
+        // Meshlets are built greedily : starting from a seed triangle, the adjacent triangle that adds the fewest new
+        // vertices to the meshlet is added until one of the limits is reached. Seeds are picked in index buffer order,
+        // so running the mesh optimizer first gives meshlets with better locality.
+        [[nodiscard]] static MeshletData buildMeshlets(std::span<const uint32_t> indices,
+                                                       std::span<const math::XMFLOAT3> positions,
+                                                       const uint32_t maxVertices = MAX_MESHLET_VERTICES,
+                                                       const uint32_t maxTriangles = MAX_MESHLET_TRIANGLES);
+
+        // Computes the bounding sphere (Ritter) and normal cone of a single meshlet. meshletVertices and
+        // meshletTriangles are the ranges of the meshlet in MeshletData::vertices and MeshletData::triangles.
+        [[nodiscard]] static MeshletBounds computeMeshletBounds(std::span<const uint32_t> meshletVertices,
+                                                                std::span<const uint32_t> meshletTriangles,
+                                                                std::span<const math::XMFLOAT3> positions);
+
+        static constexpr uint32_t packTriangle(const uint32_t a, const uint32_t b, const uint32_t c)
+        {
+            return a | (b << 8u) | (c << 16u);
+        }
+
+        static constexpr std::array<uint32_t, 3> unpackTriangle(const uint32_t triangle)
+        {
+            return {triangle & 0xFFu, (triangle >> 8u) & 0xFFu, (triangle >> 16u) & 0xFFu};
+        }
+    };
+} // namespace helios::scene
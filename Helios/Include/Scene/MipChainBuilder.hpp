@@ -0,0 +1,46 @@
+#pragma once
+
+namespace helios::scene
+{
+    // Filter used to downsample each mip level.
+    enum class MipFilter : uint8_t
+    {
+        // Average of the source pixels covered by the destination pixel (fast, but blurs and aliases more).
+        Box,
+        // Kaiser windowed sinc (keeps the mips sharper).
+        Kaiser,
+    };
+
+    struct MipChainSettings
+    {
+        MipFilter filter{MipFilter::Kaiser};
+
+        // If non zero, the alpha of each mip level is scaled so that the fraction of pixels that pass the alpha test
+        // (alpha > alphaCoverageCutoff) matches mip 0. Without this, alpha tested geometry (such as foliage) gets
+        // thinner with each mip level and disappears in the distance.
+        float alphaCoverageCutoff{};
+    };
+
+    // A single mip level, with tightly packed RGBA8 pixels.
+    struct MipLevel
+    {
+        uint32_t width{};
+        uint32_t height{};
+        std::vector<uint8_t> pixels{};
+    };
+
+    // Generates the mip chain of RGBA8 images on the CPU when textures are cooked (see TextureCache), so textures are
+    // uploaded with all of their mip levels instead of being downsampled on the GPU (see gfx::MipMapGenerator), which
+    // requires a GPU round trip per texture.
+    // Filtering is done in linear space : the RGB components of sRGB images are decoded before filtering and encoded
+    // again afterwards. Each level is generated from the previous one, and the image is mirrored at its edges. The
+    // filters are separable : source rows are filtered horizontally once (and cached), then combined vertically.
+    class MipChainBuilder
+    {
+      public:
+        // Returns mip levels 1 to N (down to 1x1), mip 0 being the input image itself.
+        [[nodiscard]] static std::vector<MipLevel> buildMipChain(std::span<const uint8_t> pixels, const uint32_t width,
+                                                                 const uint32_t height, const bool isSRGB,
+                                                                 const MipChainSettings& mipChainSettings);
+    };
+} // namespace helios::scene
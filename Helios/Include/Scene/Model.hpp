@@ -2,6 +2,9 @@
 
 #include "Materials.hpp"
 #include "Mesh.hpp"
+#include "MaterialTable.hpp"
+#include "MeshCache.hpp"
+#include "TransformStore.hpp"
 
 #include "../Graphics/Resources.hpp"
 
@@ -14,19 +17,25 @@ namespace helios::gfx
 {
     class GraphicsDevice;
     class GraphicsContext;
+    class TextureStreamer;
 } // namespace helios::gfx
 
 namespace helios::scene
 {
-    struct TransformComponent
+    // Parameters used to select the LOD of each mesh : the least detailed LOD whose simplification error, projected to
+    // the render target, is at most errorThreshold pixels is rendered.
+    struct LodSelectionDesc
     {
-        math::XMFLOAT3 rotation{0.0f, 0.0f, 0.0f};
-        math::XMFLOAT3 scale{1.0f, 1.0f, 1.0f};
-        math::XMFLOAT3 translate{0.0f, 0.0f, 0.0f};
+        // World space position of the camera. Unused for orthographic projections.
+        math::XMFLOAT3 viewPosition{};
 
-        gfx::Buffer transformBuffer{};
+        // Converts a world space length into pixels : for perspective projections this is the scale at a distance of 1
+        // (viewportHeight / (2 * tan(fovY / 2))), and for orthographic projections the scale at any distance.
+        float projectionScale{};
+        bool isOrthographic{false};
 
-        void update();
+        // A threshold of 0 disables LOD selection (i.e LOD 0 is always rendered).
+        float errorThreshold{0.0f};
     };
 
     struct ModelCreationDesc
@@ -37,23 +46,55 @@ namespace helios::scene
         math::XMFLOAT3 rotation{0.0f, 0.0f, 0.0f};
         math::XMFLOAT3 scale{1.0f, 1.0f, 1.0f};
         math::XMFLOAT3 translate{0.0f, 0.0f, 0.0f};
+
+        MeshCookSettings cookSettings{};
+
+        // If true, the position / normal / texture coord buffers are quantized (see VertexQuantization) when uploaded
+        // to the GPU. Only the passes that read the vertex streams through VertexStreams.hlsli (deferred geometry and
+        // shadow pass) support quantized meshes.
+        bool quantizeVertexStreams{false};
+
+        // If true, the material textures are block compressed (see TextureCompressor) and cooked into DDS files next
+        // to the source images on first load.
+        bool compressTextures{false};
+
+        // If true, the material textures (which must be cooked, see compressTextures) are streamed by the
+        // gfx::TextureStreamer, based on the mips requested by requestTextureMips.
+        bool streamTextures{false};
     };
 
     // Model class uses tinygltf for loading GLTF models.
     // Currently, only GLTF model loading is supported. This is mostly because of the much faster load times of this
     // mesh type compared to .obj, .fbx, etc.
+    // The first time a model is loaded, the decoded data is written to a cooked mesh file (see MeshCache). Subsequent
+    // loads skip glTF parsing entirely and create the GPU resources straight from the memory mapped cooked file.
     // note(rtarun9) : For now, the Model will have ownership of meshes and materials, in future move these to the
     // ResourceManager and just obtain pointers to them, hence sharing them between all models.
+    // The transform of the model (initialized from the creation desc) is stored in the TransformStore of the scene, and
+    // the material data in its MaterialTable. Models created without a transform store / material table (such as the
+    // light and cube map models, which are positioned by their own buffers) have no transform / material data, and can
+    // only be rendered with render resources that do not use them (rendering them with the others is a fatal error).
     class Model
     {
       public:
         Model() = default;
-        Model(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc);
+        Model(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc,
+              TransformStore* const transformStore = nullptr, MaterialTable* const materialTable = nullptr);
 
-        TransformComponent& getTransformComponent()
+        // Releases the mesh buffers and samplers once the frames in flight no longer use them (see
+        // GraphicsDevice::deferRelease).
+        ~Model();
+
+        Model(const Model& other) = delete;
+        Model& operator=(const Model& other) = delete;
+
+        Model(Model&& other) = delete;
+        Model& operator=(Model&& other) = delete;
+
+        uint32_t getTransformIndex() const
         {
-            return m_transformComponent;
-        };
+            return m_transformIndex;
+        }
 
         std::vector<PBRMaterial>& getPBRMaterials()
         {
@@ -65,7 +106,11 @@ namespace helios::scene
             return m_modelName;
         }
 
-        void updateMaterialBuffer();
+        // Ticket that completes once all the resources of the model have been uploaded.
+        gfx::UploadTicket getUploadTicket() const
+        {
+            return m_uploadTicket;
+        }
 
         void render(const gfx::GraphicsContext* const graphicsContext,
                     interlop::ModelViewerRenderResources& renderResources) const;
@@ -74,24 +119,68 @@ namespace helios::scene
                     interlop::BlinnPhongRenderResources& renderResources) const;
 
         void render(const gfx::GraphicsContext* const graphicsContext,
-                    interlop::DeferredGPassRenderResources& renderResources) const;
+                    interlop::DeferredGPassRenderResources& renderResources,
+                    const LodSelectionDesc& lodSelectionDesc = {}) const;
 
         void render(const gfx::GraphicsContext* const graphicsContext,
                     interlop::CubeMapRenderResources& renderResources) const;
 
         void render(const gfx::GraphicsContext* const graphicsContext,
-                    interlop::ShadowPassRenderResources& renderResources) const;
+                    interlop::ShadowPassRenderResources& renderResources,
+                    const LodSelectionDesc& lodSelectionDesc = {}) const;
 
         void render(const gfx::GraphicsContext* const graphicsContext, interlop::LightRenderResources& renderResources,
                     const uint32_t lightInstancesCount) const;
 
+        // Requests the mips of the material textures required to render each mesh (based on the distance from the
+        // camera to the mesh and the texture coord density of the mesh). Does nothing if the textures are not streamed.
+        void requestTextureMips(gfx::TextureStreamer* const textureStreamer,
+                                const LodSelectionDesc& lodSelectionDesc) const;
+
+        // Writes the current SRV indices of the material textures to the material table (the SRV index of a streamed
+        // texture changes when its resident mips change). Only the materials whose indices changed are set.
+        void updateMaterialTextureIndices() const;
+
       private:
-        void loadNode(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc,
-                      const uint32_t nodeIndex, const tinygltf::Model& model);
-        void loadSamplers(const gfx::GraphicsDevice* const graphicsDevice, const tinygltf::Model& model);
-        void loadMaterials(const gfx::GraphicsDevice* const graphicsDevice, const tinygltf::Model& model);
+        // Identity for models that have no transform.
+        math::XMMATRIX getModelMatrix() const;
+        float getMaxScale() const;
+
+        // Returns the LOD to render (0 being the source mesh, i being mesh.lods[i - 1]).
+        uint32_t selectLod(const Mesh& mesh, const math::XMMATRIX& modelMatrix, const float maxScale,
+                           const LodSelectionDesc& lodSelectionDesc) const;
+
+        // Sets the index buffer of the selected LOD and issues the draw.
+        void drawMesh(const gfx::GraphicsContext* const graphicsContext, const Mesh& mesh, const uint32_t lod) const;
+
+        // A primitive of the glTF file along with the world transform of the node it belongs to.
+        struct NodePrimitive
+        {
+            const tinygltf::Primitive* primitive{};
+            math::XMMATRIX transform{};
+        };
 
-        TransformComponent m_transformComponent{};
+        // Functions that parse the glTF file and fill in the CPU side ModelData. loadNode walks the node hierarchy and
+        // collects the primitives, which are then decoded in parallel (one job per primitive) by loadPrimitive.
+        ModelData loadGLTFModelData(const MeshCookSettings& cookSettings) const;
+        void loadNode(std::vector<NodePrimitive>& nodePrimitives, const uint32_t nodeIndex,
+                      const tinygltf::Model& model, const math::XMMATRIX& parentTransform) const;
+        MeshData loadPrimitive(const NodePrimitive& nodePrimitive, const tinygltf::Model& model) const;
+
+        // Functions that create the GPU resources. The source data can either be from the glTF file or the cooked
+        // mesh file. Textures and meshes are created by jobs of the job system (see JobSystem).
+        void createResources(const gfx::GraphicsDevice* const graphicsDevice, std::span<const SamplerData> samplers,
+                             std::span<const MaterialData> materials, std::span<const MeshView> meshes);
+        void loadSamplers(const gfx::GraphicsDevice* const graphicsDevice, std::span<const SamplerData> samplers);
+        void loadMaterials(const gfx::GraphicsDevice* const graphicsDevice, std::span<const MaterialData> materials);
+        void loadMeshes(const gfx::GraphicsDevice* const graphicsDevice, std::span<const MeshView> meshes);
+
+        const gfx::GraphicsDevice* m_graphicsDevice{};
+
+        TransformStore* m_transformStore{};
+        uint32_t m_transformIndex{INVALID_INDEX_U32};
+
+        MaterialTable* m_materialTable{};
 
       public:
         std::wstring m_modelName{};
@@ -103,5 +192,11 @@ namespace helios::scene
 
         std::wstring m_modelPath{};
         std::wstring m_modelDirectory{};
+
+        bool m_quantizeVertexStreams{false};
+        bool m_compressTextures{false};
+        bool m_streamTextures{false};
+
+        gfx::UploadTicket m_uploadTicket{};
     };
 } // namespace helios::scene
\ No newline at end of file
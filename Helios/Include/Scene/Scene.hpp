@@ -4,7 +4,9 @@
 #include "Scene/Camera.hpp"
 #include "Scene/CubeMap.hpp"
 #include "Scene/Lights.hpp"
+#include "Scene/MaterialTable.hpp"
 #include "Scene/Model.hpp"
+#include "Scene/TransformStore.hpp"
 
 namespace helios::gfx
 {
@@ -32,8 +34,23 @@ namespace helios::scene
         // use case requires it.
         void completeResourceLoading();
 
-        // Update scene resources (models, lights, etc).
-        void update(const float deltaTime, const core::Input& input, const float aspectRatio);
+        // Non blocking alternative to completeResourceLoading, called once per frame : models are added to m_models
+        // once they have been created and their uploads have completed (see gfx::UploadTicket).
+        void pollResourceLoading(const gfx::GraphicsDevice* const graphicsDevice);
+
+        // Update scene resources (models, lights, etc). The scene and light buffers are allocated from the frame
+        // constants of the graphics device, so this must be called once per frame before the scene is rendered.
+        void update(const gfx::GraphicsDevice* const graphicsDevice, const float deltaTime, const core::Input& input,
+                    const uint32_t viewportWidth, const uint32_t viewportHeight);
+
+        // Requests the texture mips required to render the models from the camera, and streams them in (or out) under
+        // the video memory budget of the texture streamer. The texture indices of the streamed materials are updated
+        // here, so this must be called once per frame, after update and before updateMaterials.
+        void streamTextures(const gfx::GraphicsDevice* const graphicsDevice);
+
+        // Writes the materials that changed since the last frame to the material table. Must be called once per frame,
+        // after streamTextures (if textures are streamed) and before the scene is rendered.
+        void updateMaterials(const gfx::GraphicsDevice* const graphicsDevice);
 
         // Render models using various render resources.
         void renderModels(const gfx::GraphicsContext* const graphicsContext);
@@ -43,27 +60,55 @@ namespace helios::scene
                           const interlop::PBRRenderResources& renderResources);
         void renderModels(const gfx::GraphicsContext* const graphicsContext,
                           const interlop::DeferredGPassRenderResources& renderResources);
+        // shadowMapTexelsPerUnit is the number of shadow map texels per world space unit (of the orthographic light
+        // projection), used for LOD selection.
         void renderModels(const gfx::GraphicsContext* const graphicsContext,
-                          const interlop::ShadowPassRenderResources& renderResources);
+                          const interlop::ShadowPassRenderResources& renderResources,
+                          const float shadowMapTexelsPerUnit);
 
         void renderLights(const gfx::GraphicsContext* const graphicsContext);
 
         void renderCubeMap(const gfx::GraphicsContext* const graphicsContext, const uint32_t cubeMapTextureIndex = INVALID_INDEX_U32);
 
+      private:
+        // LOD selection parameters of the perspective camera (also used to request the texture mips).
+        LodSelectionDesc getCameraLodSelectionDesc() const;
+
       public:
-        gfx::Buffer m_sceneBuffer{};
+        gfx::FrameConstantBuffer m_sceneBuffer{};
         Camera m_camera{};
 
         float m_nearPlane{0.1f};
         float m_farPlane{300.0f};
         float m_fov{45.0f};
 
+        // Height of the viewport the scene was last updated with, used for LOD selection.
+        uint32_t m_viewportHeight{1u};
+
+        // Maximum screen space error (in pixels) of the LOD selected for each mesh. Shadow maps are filtered and
+        // rendered with a large orthographic extent, so a more aggressive threshold is used for the shadow pass.
+        float m_lodErrorThreshold{1.0f};
+        float m_shadowLodErrorThreshold{4.0f};
+
         std::optional<Lights> m_lights{};
         std::optional<CubeMap> m_cubeMap{};
 
+        // Transforms and material data of all models (see Model::getTransformIndex and PBRMaterial::materialIndex).
+        // Heap allocated, as models hold pointers to them.
+        std::unique_ptr<TransformStore> m_transformStore{};
+        std::unique_ptr<MaterialTable> m_materialTable{};
+
+        // Residency change count of the texture streamer when the material texture indices were last updated, and
+        // whether models have been added since (see streamTextures).
+        uint64_t m_textureResidencyChangeCount{};
+        bool m_hasNewModels{};
+
         std::unordered_map<std::wstring, std::unique_ptr<Model>> m_models{};
 
         std::unordered_map<std::wstring, std::future<std::unique_ptr<Model>>> m_modelFutures{};
+
+        // Models that have been created, but whose uploads may not have completed yet.
+        std::unordered_map<std::wstring, std::unique_ptr<Model>> m_loadedModels{};
     };
 
 } // namespace helios::scene
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Materials.hpp"
+#include "MipChainBuilder.hpp"
+
+namespace helios::gfx
+{
+    class GraphicsDevice;
+} // namespace helios::gfx
+
+namespace helios::scene
+{
+    // Cache of the textures created from image files, shared by all materials and models. glTF files often reference
+    // the same image from several materials, and scenes often load the same model (or models sharing texture atlases)
+    // multiple times : with the cache, each image is decoded and uploaded once per format.
+    // Entries are keyed by the normalized image path and the texture format (the same image can be used both as a
+    // sRGB and a linear texture). The cache only holds the handles of the textures (in the texture pool of the device),
+    // not references to them : a texture is released once the last material using it is destroyed, and loading the
+    // image again after that decodes it again.
+    // Thread safe : if multiple jobs request the same image at the same time, one of them loads it while the others
+    // wait for it.
+    // Images are cooked into DDS files next to the image on first load : the mip chain is generated on the CPU (see
+    // MipChainBuilder) and, for block compressed formats, compressed by the TextureCompressor. Later loads read the DDS
+    // file directly, and upload all mip levels at once (or only the tail of the mip chain, for textures that are
+    // streamed by the gfx::TextureStreamer).
+    class TextureCache
+    {
+      public:
+        // Increment when the cooking process changes, so that previously cooked textures are cooked again.
+        static constexpr uint32_t TEXTURE_COOK_VERSION = 2u;
+
+        static TextureCache& get();
+
+        // Returns the texture for the image at texturePath, loading it if it is not in the cache. The format and name
+        // are taken from textureCreationDesc (the dimensions and mip levels are set based on the image). Textures
+        // cooked with different mip chain settings are different entries. If streamMips is true, the texture is
+        // registered with the texture streamer, and its mips are only resident while they are requested (see
+        // Model::requestTextureMips). Streamed and fully resident textures are different entries.
+        // A reference to the texture is added for the caller, and is to be removed with
+        // GraphicsDevice::releaseTexture.
+        [[nodiscard]] gfx::TextureHandle getTexture(const gfx::GraphicsDevice* const graphicsDevice,
+                                                    const std::string_view texturePath,
+                                                    const gfx::TextureCreationDesc& textureCreationDesc,
+                                                    const MipChainSettings& mipChainSettings = {},
+                                                    const bool streamMips = false);
+
+      private:
+        struct CacheEntry
+        {
+            // Held while the texture is being loaded.
+            std::mutex mutex{};
+            gfx::TextureHandle texture{};
+        };
+
+        // Adds the texture to the texture pool (with a single reference).
+        static gfx::TextureHandle loadTexture(const gfx::GraphicsDevice* const graphicsDevice,
+                                              const std::string_view texturePath,
+                                              const gfx::TextureCreationDesc& textureCreationDesc,
+                                              const MipChainSettings& mipChainSettings, const bool streamMips);
+
+      private:
+        std::mutex m_entriesMutex{};
+        std::unordered_map<std::string, std::shared_ptr<CacheEntry>> m_entries{};
+    };
+} // namespace helios::scene
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "MeshCache.hpp"
+
+namespace helios::scene
+{
+    // CPU block compression (BC1 / BC3 / BC4 / BC5 / BC7) of 8 bit per component RGBA images. Used to cook the
+    // material textures of models into DDS files (see TextureCache), which use 4x (BC7 / BC5 / BC3) to 8x (BC1 / BC4)
+    // less memory and bandwidth than RGBA8 textures.
+    // The encoders favour speed over quality : BC1 / BC7 end points are found with PCA along the principal axis of the
+    // block and refined with a single least squares pass, BC4 / BC5 use the range of the values as end points. BC7
+    // only uses mode 6 (a single subset with RGBA end points).
+    // Compression of a single image is single threaded : it runs on the texture loading jobs (one per texture), and
+    // must not wait on other jobs while a texture cache entry is locked (see TextureCache).
+    class TextureCompressor
+    {
+      public:
+        // Returns the compressed format used for each material texture type :
+        // Albedo / Emissive : BC7 (sRGB), MetalRoughness : BC7, Normal : BC5 (the z component is reconstructed in the
+        // shader), AO : BC4 (only the r component is used).
+        static DXGI_FORMAT getCompressedFormat(const MaterialTextureType textureType);
+
+        // pixels holds the tightly packed RGBA8 pixels of the image. Returns the compressed blocks (in row order). The
+        // dimensions need not be a multiple of 4 : the edge pixels are replicated to fill the partial blocks.
+        [[nodiscard]] static std::vector<std::byte> compress(const DXGI_FORMAT format, std::span<const uint8_t> pixels,
+                                                             const uint32_t width, const uint32_t height);
+    };
+} // namespace helios::scene
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Graphics/Resources.hpp"
+
+namespace helios::gfx
+{
+    class GraphicsDevice;
+}
+
+namespace helios::scene
+{
+    struct TransformCreationDesc
+    {
+        math::XMFLOAT3 rotation{0.0f, 0.0f, 0.0f};
+        math::XMFLOAT3 scale{1.0f, 1.0f, 1.0f};
+        math::XMFLOAT3 translate{0.0f, 0.0f, 0.0f};
+    };
+
+    // Stores the transforms of all models of a scene, each identified by a transform index. The scale / rotation /
+    // translation and the derived matrices are stored SoA, and only the transforms that changed since the last update
+    // (see the set functions) are recomputed and written to the GPU.
+    // On the GPU, the transforms are a single structured buffer of float4x4 : the model matrices of all transforms,
+    // followed by their inverse model matrices (see Shaders/Transforms.hlsli). The buffer is in CPU visible memory and
+    // there is one per frame in flight, so a frame in flight never reads a matrix while it is being written. A changed
+    // transform is written to each of these buffers as its frame comes up.
+    // Transforms can be added from any thread (as models are loaded asynchronously), but they are only valid once the
+    // update that follows the add has run. All other functions are to be called from the main thread (between update
+    // and the next update for the get functions).
+    class TransformStore
+    {
+      public:
+        explicit TransformStore(const gfx::GraphicsDevice* const graphicsDevice);
+
+        [[nodiscard]] uint32_t addTransform(const TransformCreationDesc& transformCreationDesc);
+
+        const math::XMFLOAT3& getRotation(const uint32_t transformIndex) const
+        {
+            return m_rotations[transformIndex];
+        }
+
+        const math::XMFLOAT3& getScale(const uint32_t transformIndex) const
+        {
+            return m_scales[transformIndex];
+        }
+
+        const math::XMFLOAT3& getTranslate(const uint32_t transformIndex) const
+        {
+            return m_translations[transformIndex];
+        }
+
+        void setRotation(const uint32_t transformIndex, const math::XMFLOAT3& rotation);
+        void setScale(const uint32_t transformIndex, const math::XMFLOAT3& scale);
+        void setTranslate(const uint32_t transformIndex, const math::XMFLOAT3& translate);
+
+        [[nodiscard]] math::XMMATRIX getModelMatrix(const uint32_t transformIndex) const;
+        [[nodiscard]] float getMaxScale(const uint32_t transformIndex) const;
+
+        // Adds the transforms added since the last update, recomputes the changed matrices, and writes them to the
+        // buffer of the current frame in flight. To be called once per frame, before the models are rendered.
+        void update(const gfx::GraphicsDevice* const graphicsDevice);
+
+        // SRV of the buffer written by the last update.
+        uint32_t getSrvIndex() const
+        {
+            return m_buffers[m_currentBufferIndex].srvIndex;
+        }
+
+        uint32_t getTransformCount() const
+        {
+            return static_cast<uint32_t>(m_scales.size());
+        }
+
+      private:
+        void markDirty(const uint32_t transformIndex);
+
+        // Recreates the buffers with space for at least transformCount transforms. All transforms are written to the
+        // new buffers as their frames come up.
+        void growBuffers(const gfx::GraphicsDevice* const graphicsDevice, const uint32_t transformCount);
+
+      private:
+        std::vector<math::XMFLOAT3> m_rotations{};
+        std::vector<math::XMFLOAT3> m_scales{};
+        std::vector<math::XMFLOAT3> m_translations{};
+
+        std::vector<math::XMFLOAT4X4> m_modelMatrices{};
+        std::vector<math::XMFLOAT4X4> m_inverseModelMatrices{};
+
+        // Transforms whose matrices have to be recomputed in the next update.
+        std::vector<uint8_t> m_isDirty{};
+        std::vector<uint32_t> m_dirtyIndices{};
+
+        // Transforms that have not been written to all buffers since they last changed. m_changeUpdates holds the
+        // update (m_updateCount) in which each transform last changed, and m_bufferUpdates the update in which each
+        // buffer was last written.
+        std::vector<uint64_t> m_changeUpdates{};
+        std::vector<uint8_t> m_isPendingWrite{};
+        std::vector<uint32_t> m_pendingWriteIndices{};
+
+        std::vector<gfx::Buffer> m_buffers{};
+        std::vector<uint64_t> m_bufferUpdates{};
+        uint32_t m_bufferCapacity{};
+        uint32_t m_currentBufferIndex{};
+
+        uint64_t m_updateCount{};
+
+        // Transforms added (by any thread) since the last update. Indices are assigned when the transform is added.
+        std::vector<TransformCreationDesc> m_addedTransforms{};
+        uint32_t m_addedTransformCount{};
+        std::mutex m_addMutex{};
+    };
+} // namespace helios::scene
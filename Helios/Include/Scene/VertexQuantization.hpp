@@ -0,0 +1,33 @@
+#pragma once
+
+namespace helios::scene
+{
+    // Layout of a quantized position, matches StructuredBuffer<uint2> in the shader (see VertexStreams.hlsli).
+    // Components are 16 bit unorm values relative to the AABB of the mesh.
+    struct QuantizedPosition
+    {
+        uint16_t x{};
+        uint16_t y{};
+        uint16_t z{};
+        uint16_t padding{};
+    };
+
+    // Functions to create the quantized vertex streams (16 bytes per vertex instead of 32) :
+    // position : 3 x 16 bit unorm relative to the mesh AABB (+ 16 bits of padding).
+    // normal : octahedral encoded, 2 x 16 bit snorm.
+    // texture coord : 2 x half.
+    // The streams are decoded by the shaders (see VertexStreams.hlsli).
+    class VertexQuantization
+    {
+      public:
+        [[nodiscard]] static std::vector<QuantizedPosition> quantizePositions(std::span<const math::XMFLOAT3> positions,
+                                                                              const math::XMFLOAT3& minBounds,
+                                                                              const math::XMFLOAT3& maxBounds);
+
+        // Reference : A Survey of Efficient Representations for Independent Unit Vectors (Cigolle et al.).
+        [[nodiscard]] static std::vector<uint32_t> encodeOctahedralNormals(std::span<const math::XMFLOAT3> normals);
+
+        [[nodiscard]] static std::vector<uint32_t> encodeHalfTextureCoords(
+            std::span<const math::XMFLOAT2> textureCoords);
+    };
+} // namespace helios::scene
@@ -0,0 +1,137 @@
+#include "Core/ImageDecoder.hpp"
+
+#include <stb_image.h>
+
+namespace helios::core
+{
+    DecodedImage::~DecodedImage()
+    {
+        release();
+    }
+
+    DecodedImage::DecodedImage(DecodedImage&& other) noexcept
+        : m_decoder(std::exchange(other.m_decoder, nullptr)), m_data(std::exchange(other.m_data, nullptr)),
+          m_width(std::exchange(other.m_width, 0u)), m_height(std::exchange(other.m_height, 0u)),
+          m_sizeInBytes(std::exchange(other.m_sizeInBytes, 0u))
+    {
+    }
+
+    DecodedImage& DecodedImage::operator=(DecodedImage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            m_decoder = std::exchange(other.m_decoder, nullptr);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_width = std::exchange(other.m_width, 0u);
+            m_height = std::exchange(other.m_height, 0u);
+            m_sizeInBytes = std::exchange(other.m_sizeInBytes, 0u);
+        }
+
+        return *this;
+    }
+
+    void DecodedImage::release()
+    {
+        if (m_data)
+        {
+            stbi_image_free(m_data);
+            m_data = nullptr;
+        }
+
+        if (m_decoder)
+        {
+            m_decoder->release(m_sizeInBytes);
+            m_decoder = nullptr;
+        }
+
+        m_sizeInBytes = 0u;
+    }
+
+    ImageDecoder::ImageDecoder(const size_t stagingBudget) : m_stagingBudget(stagingBudget)
+    {
+    }
+
+    ImageDecoder& ImageDecoder::get()
+    {
+        static ImageDecoder imageDecoder(DEFAULT_STAGING_BUDGET);
+
+        return imageDecoder;
+    }
+
+    DecodedImage ImageDecoder::decode(const std::string_view imagePath)
+    {
+        return decode(imagePath, false);
+    }
+
+    DecodedImage ImageDecoder::decodeHDR(const std::string_view imagePath)
+    {
+        return decode(imagePath, true);
+    }
+
+    DecodedImage ImageDecoder::decode(const std::string_view imagePath, const bool isHDR)
+    {
+        static constexpr int32_t COMPONENT_COUNT = 4;
+
+        const std::string imagePathStr{imagePath};
+
+        // The dimensions are read from the header first, so the memory can be reserved before decoding.
+        int32_t width{}, height{};
+        if (!stbi_info(imagePathStr.c_str(), &width, &height, nullptr))
+        {
+            fatalError(std::format("Failed to load texture from path : {}.", imagePathStr));
+        }
+
+        const size_t sizeInBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * COMPONENT_COUNT *
+                                   (isHDR ? sizeof(float) : sizeof(uint8_t));
+
+        reserve(sizeInBytes);
+
+        DecodedImage decodedImage{};
+        decodedImage.m_decoder = this;
+        decodedImage.m_sizeInBytes = sizeInBytes;
+
+        if (isHDR)
+        {
+            decodedImage.m_data = reinterpret_cast<std::byte*>(
+                stbi_loadf(imagePathStr.c_str(), &width, &height, nullptr, COMPONENT_COUNT));
+        }
+        else
+        {
+            decodedImage.m_data = reinterpret_cast<std::byte*>(
+                stbi_load(imagePathStr.c_str(), &width, &height, nullptr, COMPONENT_COUNT));
+        }
+
+        if (!decodedImage.m_data)
+        {
+            fatalError(std::format("Failed to load texture from path : {}.", imagePathStr));
+        }
+
+        decodedImage.m_width = static_cast<uint32_t>(width);
+        decodedImage.m_height = static_cast<uint32_t>(height);
+
+        return decodedImage;
+    }
+
+    void ImageDecoder::reserve(const size_t sizeInBytes)
+    {
+        std::unique_lock lock(m_mutex);
+
+        m_releaseCondition.wait(lock, [&]() {
+            return m_reservedSize == 0u || m_reservedSize + sizeInBytes <= m_stagingBudget;
+        });
+
+        m_reservedSize += sizeInBytes;
+    }
+
+    void ImageDecoder::release(const size_t sizeInBytes)
+    {
+        {
+            const std::scoped_lock lock(m_mutex);
+            m_reservedSize -= sizeInBytes;
+        }
+
+        m_releaseCondition.notify_all();
+    }
+} // namespace helios::core
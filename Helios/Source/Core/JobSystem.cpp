@@ -0,0 +1,324 @@
+#include "Core/JobSystem.hpp"
+
+namespace helios::core
+{
+    namespace
+    {
+        // Set for the worker threads of the job system, so submitted jobs can be pushed to the worker's own deque.
+        thread_local const JobSystem* t_jobSystem{};
+        thread_local uint32_t t_workerIndex{INVALID_INDEX_U32};
+    } // namespace
+
+    JobSystem::JobSystem(const uint32_t workerCount)
+    {
+        m_workerQueues.reserve(workerCount);
+        for ([[maybe_unused]] const uint32_t i : std::views::iota(0u, workerCount))
+        {
+            m_workerQueues.emplace_back(std::make_unique<WorkerQueue>());
+        }
+
+        m_workers.reserve(workerCount);
+        for (const uint32_t i : std::views::iota(0u, workerCount))
+        {
+            m_workers.emplace_back([this, i](const std::stop_token stopToken) { workerLoop(stopToken, i); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        for (std::jthread& worker : m_workers)
+        {
+            worker.request_stop();
+        }
+
+        m_wakeCondition.notify_all();
+    }
+
+    JobSystem& JobSystem::get()
+    {
+        // The thread that submits work helps while waiting, so one hardware thread is left for it.
+        static JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
+
+        return jobSystem;
+    }
+
+    void JobSystem::submit(std::function<void()> job, JobCounter* const counter)
+    {
+        pushJob(wrapJob(std::move(job), counter));
+    }
+
+    void JobSystem::submit(std::function<void()> job, JobCounter* const counter, JobCounter& dependency)
+    {
+        // The counter is incremented right away, so that waiting on it also waits for the dependency.
+        std::function<void()> wrappedJob = wrapJob(std::move(job), counter);
+
+        {
+            const std::scoped_lock lock(dependency.m_dependentJobsMutex);
+            if (!dependency.isComplete())
+            {
+                dependency.m_dependentJobs.emplace_back(std::move(wrappedJob));
+                return;
+            }
+        }
+
+        pushJob(std::move(wrappedJob));
+    }
+
+    void JobSystem::dispatch(const uint32_t count, const uint32_t batchSize, std::function<void(const uint32_t)> job,
+                             JobCounter* const counter)
+    {
+        const uint32_t clampedBatchSize = std::max(batchSize, 1u);
+
+        for (uint32_t batchStart = 0u; batchStart < count; batchStart += clampedBatchSize)
+        {
+            const uint32_t batchEnd = std::min(batchStart + clampedBatchSize, count);
+
+            submit(
+                [job, batchStart, batchEnd]() {
+                    for (const uint32_t i : std::views::iota(batchStart, batchEnd))
+                    {
+                        job(i);
+                    }
+                },
+                counter);
+        }
+    }
+
+    void JobSystem::wait(const JobCounter& counter)
+    {
+        while (!counter.isComplete())
+        {
+            if (!executePendingJob())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // The job that completed the counter may still hold the mutex (while releasing the dependent jobs). Acquiring
+        // it here guarantees that the counter is no longer accessed once wait returns, so it can be destroyed.
+        const std::scoped_lock lock(counter.m_dependentJobsMutex);
+    }
+
+    void JobSystem::join(const JobCounter& counter)
+    {
+        while (!counter.isComplete())
+        {
+            if (const std::optional<ForkedJob> forkedJob = popForkedJob(); forkedJob.has_value())
+            {
+                executeForkedJob(*forkedJob);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // See wait.
+        const std::scoped_lock lock(counter.m_dependentJobsMutex);
+    }
+
+    void JobSystem::workerLoop(const std::stop_token stopToken, const uint32_t workerIndex)
+    {
+        t_jobSystem = this;
+        t_workerIndex = workerIndex;
+
+        while (!stopToken.stop_requested())
+        {
+            if (executePendingJob())
+            {
+                continue;
+            }
+
+            std::unique_lock lock(m_wakeMutex);
+            m_wakeCondition.wait(lock, stopToken, [&]() { return m_pendingJobCount.load() > 0u; });
+        }
+    }
+
+    std::function<void()> JobSystem::wrapJob(std::function<void()> job, JobCounter* const counter)
+    {
+        if (!counter)
+        {
+            return job;
+        }
+
+        counter->m_count.fetch_add(1u, std::memory_order_relaxed);
+
+        return [this, job = std::move(job), counter]() {
+            job();
+            completeJob(counter);
+        };
+    }
+
+    void JobSystem::completeJob(JobCounter* const counter)
+    {
+        std::vector<std::function<void()>> dependentJobs{};
+
+        {
+            const std::scoped_lock lock(counter->m_dependentJobsMutex);
+            if (counter->m_count.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+            {
+                dependentJobs.swap(counter->m_dependentJobs);
+            }
+        }
+
+        for (std::function<void()>& dependentJob : dependentJobs)
+        {
+            pushJob(std::move(dependentJob));
+        }
+    }
+
+    void JobSystem::pushJob(std::function<void()> job)
+    {
+        WorkerQueue& queue = t_jobSystem == this ? *m_workerQueues[t_workerIndex] : m_sharedQueue;
+
+        {
+            // The count is incremented before the job is published, so that a worker that pops the job right away can
+            // not decrement it below zero.
+            const std::scoped_lock lock(queue.mutex);
+            m_pendingJobCount.fetch_add(1u);
+            queue.jobs.emplace_back(std::move(job));
+        }
+
+        wakeWorker();
+    }
+
+    void JobSystem::forkJob(const ForkedJob& forkedJob)
+    {
+        forkedJob.counter->m_count.fetch_add(1u, std::memory_order_relaxed);
+
+        bool isQueued{false};
+
+        {
+            const std::scoped_lock lock(m_forkedJobsMutex);
+            if (m_forkedJobCount < MAX_FORKED_JOBS)
+            {
+                // As for pushJob, the count is incremented before the job is published.
+                m_pendingJobCount.fetch_add(1u);
+                m_forkedJobs[(m_firstForkedJobIndex + m_forkedJobCount++) % MAX_FORKED_JOBS] = forkedJob;
+                isQueued = true;
+            }
+        }
+
+        if (!isQueued)
+        {
+            executeForkedJob(forkedJob);
+            return;
+        }
+
+        wakeWorker();
+    }
+
+    void JobSystem::executeForkedJob(const ForkedJob& forkedJob)
+    {
+        forkedJob.invoke(forkedJob.job);
+        completeJob(forkedJob.counter);
+    }
+
+    void JobSystem::wakeWorker()
+    {
+        // Lock the wake mutex so that a worker that just found the queues empty can not miss the notification.
+        {
+            const std::scoped_lock lock(m_wakeMutex);
+        }
+
+        m_wakeCondition.notify_one();
+    }
+
+    std::optional<std::function<void()>> JobSystem::popJob()
+    {
+        const auto popFromQueue = [&](WorkerQueue& queue,
+                                      const bool popNewest) -> std::optional<std::function<void()>> {
+            const std::scoped_lock lock(queue.mutex);
+            if (queue.jobs.empty())
+            {
+                return std::nullopt;
+            }
+
+            std::function<void()> job{};
+            if (popNewest)
+            {
+                job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+            }
+            else
+            {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+            }
+
+            m_pendingJobCount.fetch_sub(1u);
+
+            return job;
+        };
+
+        const bool isWorker = t_jobSystem == this;
+        const uint32_t workerCount = getWorkerCount();
+
+        // Own deque first (newest job), then the shared queue and other workers (oldest job).
+        if (isWorker)
+        {
+            if (std::optional<std::function<void()>> job = popFromQueue(*m_workerQueues[t_workerIndex], true))
+            {
+                return job;
+            }
+        }
+
+        if (std::optional<std::function<void()>> job = popFromQueue(m_sharedQueue, false))
+        {
+            return job;
+        }
+
+        const uint32_t firstVictimIndex = isWorker ? t_workerIndex + 1u : 0u;
+        for (const uint32_t i : std::views::iota(0u, workerCount))
+        {
+            const uint32_t victimIndex = (firstVictimIndex + i) % workerCount;
+            if (isWorker && victimIndex == t_workerIndex)
+            {
+                continue;
+            }
+
+            if (std::optional<std::function<void()>> job = popFromQueue(*m_workerQueues[victimIndex], false))
+            {
+                return job;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<JobSystem::ForkedJob> JobSystem::popForkedJob()
+    {
+        const std::scoped_lock lock(m_forkedJobsMutex);
+        if (m_forkedJobCount == 0u)
+        {
+            return std::nullopt;
+        }
+
+        const ForkedJob forkedJob = m_forkedJobs[m_firstForkedJobIndex];
+
+        m_firstForkedJobIndex = (m_firstForkedJobIndex + 1u) % MAX_FORKED_JOBS;
+        --m_forkedJobCount;
+
+        m_pendingJobCount.fetch_sub(1u);
+
+        return forkedJob;
+    }
+
+    bool JobSystem::executePendingJob()
+    {
+        // Forked jobs are usually on the critical path of the frame, so they are executed first.
+        if (const std::optional<ForkedJob> forkedJob = popForkedJob(); forkedJob.has_value())
+        {
+            executeForkedJob(*forkedJob);
+            return true;
+        }
+
+        if (std::optional<std::function<void()>> job = popJob(); job.has_value())
+        {
+            (*job)();
+            return true;
+        }
+
+        return false;
+    }
+} // namespace helios::core
@@ -0,0 +1,91 @@
+#include "Core/MemoryMappedFile.hpp"
+
+namespace helios::core
+{
+    MemoryMappedFile::MemoryMappedFile(const std::wstring_view filePath)
+    {
+        const std::wstring path{filePath};
+
+        m_fileHandle = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!::GetFileSizeEx(m_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            close();
+            return;
+        }
+
+        m_fileMappingHandle = ::CreateFileMappingW(m_fileHandle, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+        if (!m_fileMappingHandle)
+        {
+            close();
+            return;
+        }
+
+        m_data = static_cast<const std::byte*>(::MapViewOfFile(m_fileMappingHandle, FILE_MAP_READ, 0u, 0u, 0u));
+        if (!m_data)
+        {
+            close();
+            return;
+        }
+
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        : m_fileHandle(std::exchange(other.m_fileHandle, INVALID_HANDLE_VALUE)),
+          m_fileMappingHandle(std::exchange(other.m_fileMappingHandle, nullptr)),
+          m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0u))
+    {
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (&other == this)
+        {
+            return *this;
+        }
+
+        close();
+
+        m_fileHandle = std::exchange(other.m_fileHandle, INVALID_HANDLE_VALUE);
+        m_fileMappingHandle = std::exchange(other.m_fileMappingHandle, nullptr);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0u);
+
+        return *this;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (m_data)
+        {
+            ::UnmapViewOfFile(m_data);
+            m_data = nullptr;
+        }
+
+        if (m_fileMappingHandle)
+        {
+            ::CloseHandle(m_fileMappingHandle);
+            m_fileMappingHandle = nullptr;
+        }
+
+        if (m_fileHandle != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_fileHandle);
+            m_fileHandle = INVALID_HANDLE_VALUE;
+        }
+
+        m_size = 0u;
+    }
+} // namespace helios::core
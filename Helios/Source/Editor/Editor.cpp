@@ -41,14 +41,15 @@ namespace helios::editor
 
         ImGui_ImplSDL2_InitForD3D(window);
 
-        gfx::DescriptorHandle srvDescriptorHandle =
-            graphicsDevice->getCbvSrvUavDescriptorHeap()->getCurrentDescriptorHandle();
+        // ImGui writes the font SRV to the shader visible heap directly (it is not staged).
+        gfx::DescriptorHeap* const cbvSrvUavDescriptorHeap = graphicsDevice->getCbvSrvUavDescriptorHeap();
+        const gfx::DescriptorHandle srvDescriptorHandle =
+            cbvSrvUavDescriptorHeap->getDescriptorHandleFromIndex(cbvSrvUavDescriptorHeap->allocateDescriptors());
 
         ImGui_ImplDX12_Init(graphicsDevice->getDevice(), gfx::GraphicsDevice::FRAMES_IN_FLIGHT,
                             graphicsDevice->getSwapchainBackBufferFormat(),
-                            graphicsDevice->getCbvSrvUavDescriptorHeap()->getDescriptorHeap(),
-                            srvDescriptorHandle.cpuDescriptorHandle, srvDescriptorHandle.gpuDescriptorHandle);
-        graphicsDevice->getCbvSrvUavDescriptorHeap()->offsetCurrentHandle();
+                            cbvSrvUavDescriptorHeap->getDescriptorHeap(), srvDescriptorHandle.cpuDescriptorHandle,
+                            srvDescriptorHandle.gpuDescriptorHandle);
 
         m_contentBrowserCurrentPath = core::FileSystem::getFullPath(L"Assets");
     }
@@ -102,6 +103,9 @@ namespace helios::editor
             // Render light properties.
             renderLightProperties(scene);
 
+            // Render texture streaming properties.
+            renderTextureStreamingProperties(graphicsDevice);
+
             // Render Deferred GBuffer data.
             renderDeferredGBuffer(graphicsDevice, deferredGBuffer);
 
@@ -142,20 +146,33 @@ namespace helios::editor
             {
                 // Scale uniformally along all axises.
                 ImGui::Checkbox("Uniform Scale", &uniformScale);
-                ImGui::SliderFloat3("Scale", &model->getTransformComponent().scale.x, 0.1f, 15.0f);
 
-                if (uniformScale)
+                // The transform store only recomputes transforms that are set, so they are set only when edited.
+                const uint32_t transformIndex = model->getTransformIndex();
+
+                math::XMFLOAT3 scale = scene.m_transformStore->getScale(transformIndex);
+                if (ImGui::SliderFloat3("Scale", &scale.x, 0.1f, 15.0f))
                 {
-                    model->getTransformComponent().scale = {
-                        model->getTransformComponent().scale.x,
-                        model->getTransformComponent().scale.x,
-                        model->getTransformComponent().scale.x,
-                    };
+                    if (uniformScale)
+                    {
+                        scale = {scale.x, scale.x, scale.x};
+                    }
+
+                    scene.m_transformStore->setScale(transformIndex, scale);
+                }
+
+                math::XMFLOAT3 translate = scene.m_transformStore->getTranslate(transformIndex);
+                if (ImGui::SliderFloat3("Translate", &translate.x, -100.0f, 100.0f))
+                {
+                    scene.m_transformStore->setTranslate(transformIndex, translate);
                 }
 
-                ImGui::SliderFloat3("Translate", &model->getTransformComponent().translate.x, -100.0f, 100.0f);
-                ImGui::SliderFloat3("Rotate", &model->getTransformComponent().rotation.x,
-                                    DirectX::XMConvertToRadians(-180.0f), DirectX::XMConvertToRadians(180.0f));
+                math::XMFLOAT3 rotation = scene.m_transformStore->getRotation(transformIndex);
+                if (ImGui::SliderFloat3("Rotate", &rotation.x, DirectX::XMConvertToRadians(-180.0f),
+                                        DirectX::XMConvertToRadians(180.0f)))
+                {
+                    scene.m_transformStore->setRotation(transformIndex, rotation);
+                }
 
                 ImGui::TreePop();
             }
@@ -182,21 +199,33 @@ namespace helios::editor
                     {
                         // note(rtarun9) : Display albedo texture, maybe this can be used to find which material we are
                         // referring to?
-                        if (material[i].albedoTexture.srvIndex != INVALID_INDEX_U32)
+                        if (const gfx::Texture* const albedoTexture =
+                                graphicsDevice->getTexturePool()->get(material[i].albedoTexture))
                         {
                             const gfx::DescriptorHandle& albedoSrvHandle =
                                 graphicsDevice->getCbvSrvUavDescriptorHeap()->getDescriptorHandleFromIndex(
-                                    material[i].albedoTexture.srvIndex);
+                                    albedoTexture->srvIndex);
 
                             ImGui::Image((ImTextureID)(albedoSrvHandle.gpuDescriptorHandle.ptr), ImVec2(60, 60));
                         }
 
-                        ImGui::SliderFloat("Roughness Factor", &material[i].materialBufferData.roughnessFactor, 0.0f,
-                                           1.0f);
-                        ImGui::SliderFloat("Metallic Factor", &material[i].materialBufferData.metallicFactor, 0.0f,
-                                           1.0f);
-                        ImGui::SliderFloat("Emissive Factor", &material[i].materialBufferData.emissiveFactor, 0.0f,
-                                           10.0f);
+                        // The material table only writes materials that are set, so they are set only when edited.
+                        interlop::MaterialData materialData =
+                            scene.m_materialTable->getMaterial(material[i].materialIndex);
+
+                        bool isMaterialEdited{false};
+                        isMaterialEdited |=
+                            ImGui::SliderFloat("Roughness Factor", &materialData.roughnessFactor, 0.0f, 1.0f);
+                        isMaterialEdited |=
+                            ImGui::SliderFloat("Metallic Factor", &materialData.metallicFactor, 0.0f, 1.0f);
+                        isMaterialEdited |=
+                            ImGui::SliderFloat("Emissive Factor", &materialData.emissiveFactor, 0.0f, 10.0f);
+
+                        if (isMaterialEdited)
+                        {
+                            scene.m_materialTable->setMaterial(material[i].materialIndex, materialData);
+                        }
+
                         ImGui::TreePop();
                     }
                 }
@@ -295,6 +324,29 @@ namespace helios::editor
         ImGui::End();
     }
 
+    void Editor::renderTextureStreamingProperties(const gfx::GraphicsDevice* const graphicsDevice) const
+    {
+        gfx::TextureStreamer* const textureStreamer = graphicsDevice->getTextureStreamer();
+
+        ImGui::Begin("Texture Streaming");
+
+        static constexpr uint64_t BYTES_PER_MB = 1024ull * 1024ull;
+
+        int budgetMB = static_cast<int>(textureStreamer->m_settings.budgetBytes / BYTES_PER_MB);
+        if (ImGui::SliderInt("Budget (MB)", &budgetMB, 16, 4096))
+        {
+            textureStreamer->m_settings.budgetBytes = static_cast<uint64_t>(budgetMB) * BYTES_PER_MB;
+        }
+
+        ImGui::SliderFloat("Mip Bias", &textureStreamer->m_settings.mipBias, -2.0f, 4.0f);
+
+        ImGui::Text("Streamed Textures : %u", textureStreamer->getStreamedTextureCount());
+        ImGui::Text("Resident Memory (MB) : %.2f",
+                    static_cast<double>(textureStreamer->getResidentBytes()) / static_cast<double>(BYTES_PER_MB));
+
+        ImGui::End();
+    }
+
     void Editor::renderDeferredGBuffer(const gfx::GraphicsDevice* const graphicsDevice,
                                        const rendering::DeferredGeometryBuffer& deferredGBuffer) const
     {
@@ -466,8 +518,9 @@ namespace helios::editor
                         .modelName = modelName,
                     };
 
+                    // The model is loaded in the background, and rendered once its uploads have completed (see
+                    // Scene::pollResourceLoading).
                     scene.addModel(graphicsDevice, modelCreationDesc);
-                    scene.completeResourceLoading();
                 }
             }
 
@@ -57,6 +57,11 @@ namespace helios::gfx
         }
     }
 
+    void CommandQueue::waitForQueue(const CommandQueue& commandQueue, const uint64_t fenceValue) const
+    {
+        throwIfFailed(m_commandQueue->Wait(commandQueue.m_fence.Get(), fenceValue));
+    }
+
     void CommandQueue::flush()
     {
         const uint64_t fenceValueToWaitFor = signal();
@@ -0,0 +1,299 @@
+#include "Graphics/DDSFile.hpp"
+
+#include "Graphics/Resources.hpp"
+
+#include <fstream>
+
+namespace helios::gfx
+{
+    namespace
+    {
+        constexpr uint32_t makeFourCC(const char a, const char b, const char c, const char d)
+        {
+            return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8u) | (static_cast<uint32_t>(c) << 16u) |
+                   (static_cast<uint32_t>(d) << 24u);
+        }
+
+        constexpr uint32_t DDS_MAGIC = makeFourCC('D', 'D', 'S', ' ');
+
+        // Stored in the first reserved field of the header, followed by the cook version.
+        constexpr uint32_t HELIOS_COOK_TAG = makeFourCC('H', 'L', 'I', 'O');
+
+        constexpr uint32_t DDSD_CAPS = 0x1u;
+        constexpr uint32_t DDSD_HEIGHT = 0x2u;
+        constexpr uint32_t DDSD_WIDTH = 0x4u;
+        constexpr uint32_t DDSD_PIXELFORMAT = 0x1000u;
+        constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000u;
+        constexpr uint32_t DDSD_LINEARSIZE = 0x80000u;
+
+        constexpr uint32_t DDPF_FOURCC = 0x4u;
+
+        constexpr uint32_t DDSCAPS_COMPLEX = 0x8u;
+        constexpr uint32_t DDSCAPS_TEXTURE = 0x1000u;
+        constexpr uint32_t DDSCAPS_MIPMAP = 0x400000u;
+
+        constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200u;
+
+        constexpr uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3u;
+
+        struct DDSPixelFormat
+        {
+            uint32_t size{sizeof(DDSPixelFormat)};
+            uint32_t flags{};
+            uint32_t fourCC{};
+            uint32_t rgbBitCount{};
+            uint32_t rBitMask{};
+            uint32_t gBitMask{};
+            uint32_t bBitMask{};
+            uint32_t aBitMask{};
+        };
+
+        struct DDSHeader
+        {
+            uint32_t size{sizeof(DDSHeader)};
+            uint32_t flags{};
+            uint32_t height{};
+            uint32_t width{};
+            uint32_t pitchOrLinearSize{};
+            uint32_t depth{};
+            uint32_t mipMapCount{};
+            std::array<uint32_t, 11> reserved1{};
+            DDSPixelFormat pixelFormat{};
+            uint32_t caps{};
+            uint32_t caps2{};
+            uint32_t caps3{};
+            uint32_t caps4{};
+            uint32_t reserved2{};
+        };
+
+        struct DDSHeaderDX10
+        {
+            uint32_t dxgiFormat{};
+            uint32_t resourceDimension{};
+            uint32_t miscFlag{};
+            uint32_t arraySize{};
+            uint32_t miscFlags2{};
+        };
+
+        static_assert(sizeof(DDSPixelFormat) == 32u);
+        static_assert(sizeof(DDSHeader) == 124u);
+        static_assert(sizeof(DDSHeaderDX10) == 20u);
+
+        DXGI_FORMAT getFormatFromFourCC(const uint32_t fourCC)
+        {
+            switch (fourCC)
+            {
+            case makeFourCC('D', 'X', 'T', '1'): {
+                return DXGI_FORMAT_BC1_UNORM;
+            }
+            break;
+
+            case makeFourCC('D', 'X', 'T', '5'): {
+                return DXGI_FORMAT_BC3_UNORM;
+            }
+            break;
+
+            case makeFourCC('A', 'T', 'I', '1'):
+            case makeFourCC('B', 'C', '4', 'U'): {
+                return DXGI_FORMAT_BC4_UNORM;
+            }
+            break;
+
+            case makeFourCC('A', 'T', 'I', '2'):
+            case makeFourCC('B', 'C', '5', 'U'): {
+                return DXGI_FORMAT_BC5_UNORM;
+            }
+            break;
+
+            default: {
+                return DXGI_FORMAT_UNKNOWN;
+            }
+            break;
+            }
+        }
+    } // namespace
+
+    std::vector<SubresourceLayout> DDSFile::getSubresourceLayouts(const DXGI_FORMAT format, const uint32_t width,
+                                                                  const uint32_t height, const uint32_t mipLevels)
+    {
+        const bool isBlockCompressed = Texture::isBlockCompressed(format);
+        const uint32_t bytesPerBlock = Texture::getBytesPerBlock(format);
+
+        std::vector<SubresourceLayout> subresourceLayouts{};
+        subresourceLayouts.reserve(mipLevels);
+
+        size_t offset{};
+        for (const uint32_t mipLevel : std::views::iota(0u, mipLevels))
+        {
+            const uint32_t mipWidth = std::max(width >> mipLevel, 1u);
+            const uint32_t mipHeight = std::max(height >> mipLevel, 1u);
+
+            const uint32_t blockCountX = isBlockCompressed ? (mipWidth + 3u) / 4u : mipWidth;
+            const uint32_t blockCountY = isBlockCompressed ? (mipHeight + 3u) / 4u : mipHeight;
+
+            const SubresourceLayout& subresourceLayout = subresourceLayouts.emplace_back(SubresourceLayout{
+                .offset = offset,
+                .width = mipWidth,
+                .height = mipHeight,
+                .rowPitch = blockCountX * bytesPerBlock,
+                .rowCount = blockCountY,
+            });
+
+            offset += subresourceLayout.getSizeInBytes();
+        }
+
+        return subresourceLayouts;
+    }
+
+    void DDSFile::write(const std::wstring_view filePath, const DDSTextureDesc& textureDesc,
+                        std::span<const std::byte> data)
+    {
+        const std::vector<SubresourceLayout> subresourceLayouts =
+            getSubresourceLayouts(textureDesc.format, textureDesc.width, textureDesc.height, textureDesc.mipLevels);
+
+        if (data.size() != subresourceLayouts.back().offset + subresourceLayouts.back().getSizeInBytes())
+        {
+            fatalError("The texture data size does not match the size of the mip chain");
+        }
+
+        DDSHeader header = {
+            .flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE,
+            .height = textureDesc.height,
+            .width = textureDesc.width,
+            .pitchOrLinearSize = static_cast<uint32_t>(subresourceLayouts.front().getSizeInBytes()),
+            .depth = 1u,
+            .mipMapCount = textureDesc.mipLevels,
+            .pixelFormat =
+                {
+                    .flags = DDPF_FOURCC,
+                    .fourCC = makeFourCC('D', 'X', '1', '0'),
+                },
+            .caps = DDSCAPS_TEXTURE | (textureDesc.mipLevels > 1u ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0u),
+        };
+
+        header.reserved1[0] = HELIOS_COOK_TAG;
+        header.reserved1[1] = textureDesc.cookVersion;
+
+        const DDSHeaderDX10 headerDX10 = {
+            .dxgiFormat = static_cast<uint32_t>(textureDesc.format),
+            .resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D,
+            .arraySize = 1u,
+        };
+
+        // Write to a temporary file first, so a partially written file is never picked up by another load.
+        const std::filesystem::path path{filePath};
+        std::filesystem::path temporaryPath = path;
+        temporaryPath += L".tmp";
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                log(std::format(L"Failed to create texture file : {}.", filePath));
+                return;
+            }
+
+            file.write(reinterpret_cast<const char*>(&DDS_MAGIC), sizeof(DDS_MAGIC));
+            file.write(reinterpret_cast<const char*>(&header), sizeof(DDSHeader));
+            file.write(reinterpret_cast<const char*>(&headerDX10), sizeof(DDSHeaderDX10));
+            file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+            if (!file)
+            {
+                log(std::format(L"Failed to write texture file : {}.", filePath));
+                return;
+            }
+        }
+
+        std::error_code errorCode{};
+        std::filesystem::rename(temporaryPath, path, errorCode);
+        if (errorCode)
+        {
+            log(std::format(L"Failed to rename texture file : {}.", filePath));
+            std::filesystem::remove(temporaryPath, errorCode);
+        }
+    }
+
+    std::optional<DDSFile> DDSFile::open(const std::wstring_view filePath)
+    {
+        if (!std::filesystem::exists(filePath))
+        {
+            return std::nullopt;
+        }
+
+        DDSFile ddsFile{};
+        ddsFile.m_file = core::MemoryMappedFile(filePath);
+
+        const std::byte* const fileData = ddsFile.m_file.getData();
+        const size_t fileSize = ddsFile.m_file.getSize();
+
+        if (!ddsFile.m_file.isValid() || fileSize < sizeof(uint32_t) + sizeof(DDSHeader))
+        {
+            return std::nullopt;
+        }
+
+        uint32_t magic{};
+        DDSHeader header{};
+
+        std::memcpy(&magic, fileData, sizeof(uint32_t));
+        std::memcpy(&header, fileData + sizeof(uint32_t), sizeof(DDSHeader));
+
+        if (magic != DDS_MAGIC || header.size != sizeof(DDSHeader) || (header.caps2 & DDSCAPS2_CUBEMAP) != 0u ||
+            (header.pixelFormat.flags & DDPF_FOURCC) == 0u)
+        {
+            return std::nullopt;
+        }
+
+        size_t dataOffset = sizeof(uint32_t) + sizeof(DDSHeader);
+
+        DXGI_FORMAT format{DXGI_FORMAT_UNKNOWN};
+        if (header.pixelFormat.fourCC == makeFourCC('D', 'X', '1', '0'))
+        {
+            if (fileSize < dataOffset + sizeof(DDSHeaderDX10))
+            {
+                return std::nullopt;
+            }
+
+            DDSHeaderDX10 headerDX10{};
+            std::memcpy(&headerDX10, fileData + dataOffset, sizeof(DDSHeaderDX10));
+
+            if (headerDX10.resourceDimension != D3D10_RESOURCE_DIMENSION_TEXTURE2D || headerDX10.arraySize > 1u)
+            {
+                return std::nullopt;
+            }
+
+            format = static_cast<DXGI_FORMAT>(headerDX10.dxgiFormat);
+            dataOffset += sizeof(DDSHeaderDX10);
+        }
+        else
+        {
+            format = getFormatFromFourCC(header.pixelFormat.fourCC);
+        }
+
+        if (format == DXGI_FORMAT_UNKNOWN)
+        {
+            return std::nullopt;
+        }
+
+        ddsFile.m_textureDesc = DDSTextureDesc{
+            .format = format,
+            .width = header.width,
+            .height = header.height,
+            .mipLevels = std::max(header.mipMapCount, 1u),
+            .cookVersion = header.reserved1[0] == HELIOS_COOK_TAG ? header.reserved1[1] : 0u,
+        };
+
+        ddsFile.m_subresourceLayouts = getSubresourceLayouts(format, header.width, header.height,
+                                                             ddsFile.m_textureDesc.mipLevels);
+
+        const SubresourceLayout& lastSubresourceLayout = ddsFile.m_subresourceLayouts.back();
+        if (fileSize < dataOffset + lastSubresourceLayout.offset + lastSubresourceLayout.getSizeInBytes())
+        {
+            return std::nullopt;
+        }
+
+        ddsFile.m_data = fileData + dataOffset;
+
+        return ddsFile;
+    }
+} // namespace helios::gfx
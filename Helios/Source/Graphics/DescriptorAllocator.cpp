@@ -0,0 +1,303 @@
+#include "Graphics/DescriptorAllocator.hpp"
+
+namespace helios::gfx
+{
+    namespace
+    {
+        // The allocators that have not been destroyed, so that a thread that exits only returns its reserved
+        // descriptors to allocators that still exist. Never destroyed, as worker threads may exit during static
+        // destruction.
+        struct AllocatorRegistry
+        {
+            std::mutex mutex{};
+            std::vector<uint64_t> liveAllocatorIds{};
+            uint64_t nextAllocatorId{};
+        };
+
+        AllocatorRegistry& getAllocatorRegistry()
+        {
+            static AllocatorRegistry* const allocatorRegistry = new AllocatorRegistry{};
+            return *allocatorRegistry;
+        }
+
+        // The descriptors a thread has reserved (but not yet allocated) from an allocator.
+        struct ThreadCacheEntry
+        {
+            DescriptorAllocator* allocator{};
+            uint64_t allocatorId{};
+
+            uint32_t index{};
+            uint32_t count{};
+        };
+
+        struct ThreadCache
+        {
+            ~ThreadCache()
+            {
+                AllocatorRegistry& allocatorRegistry = getAllocatorRegistry();
+                const std::scoped_lock lock(allocatorRegistry.mutex);
+
+                for (const ThreadCacheEntry& entry : entries)
+                {
+                    const bool isAllocatorLive =
+                        std::ranges::find(allocatorRegistry.liveAllocatorIds, entry.allocatorId) !=
+                        allocatorRegistry.liveAllocatorIds.end();
+
+                    if (isAllocatorLive && entry.count != 0u)
+                    {
+                        entry.allocator->free(entry.index, entry.count);
+                    }
+                }
+            }
+
+            std::vector<ThreadCacheEntry> entries{};
+        };
+
+        thread_local ThreadCache t_threadCache{};
+
+        ThreadCacheEntry& getThreadCacheEntry(DescriptorAllocator* const allocator, const uint64_t allocatorId)
+        {
+            for (ThreadCacheEntry& entry : t_threadCache.entries)
+            {
+                if (entry.allocatorId == allocatorId)
+                {
+                    return entry;
+                }
+            }
+
+            return t_threadCache.entries.emplace_back(ThreadCacheEntry{
+                .allocator = allocator,
+                .allocatorId = allocatorId,
+            });
+        }
+    } // namespace
+
+    DescriptorAllocator::DescriptorAllocator(const uint32_t persistentDescriptorCount,
+                                             const uint32_t transientDescriptorCountPerFrame)
+        : m_persistentDescriptorCount(persistentDescriptorCount),
+          m_transientDescriptorCountPerFrame(transientDescriptorCountPerFrame)
+    {
+        AllocatorRegistry& allocatorRegistry = getAllocatorRegistry();
+        const std::scoped_lock lock(allocatorRegistry.mutex);
+
+        m_allocatorId = allocatorRegistry.nextAllocatorId++;
+        allocatorRegistry.liveAllocatorIds.emplace_back(m_allocatorId);
+    }
+
+    DescriptorAllocator::~DescriptorAllocator()
+    {
+        AllocatorRegistry& allocatorRegistry = getAllocatorRegistry();
+        const std::scoped_lock lock(allocatorRegistry.mutex);
+
+        std::erase(allocatorRegistry.liveAllocatorIds, m_allocatorId);
+    }
+
+    uint32_t DescriptorAllocator::allocate(const uint32_t count)
+    {
+        if (count == 1u)
+        {
+            ThreadCacheEntry& threadCacheEntry = getThreadCacheEntry(this, m_allocatorId);
+            if (threadCacheEntry.count == 0u)
+            {
+                const DescriptorRange descriptorRange = reserveThreadCacheDescriptors();
+
+                threadCacheEntry.index = descriptorRange.index;
+                threadCacheEntry.count = descriptorRange.count;
+            }
+
+            --threadCacheEntry.count;
+            return threadCacheEntry.index++;
+        }
+
+        if (const DescriptorRange descriptorRange = reserveFromCursor(count, false); descriptorRange.count != 0u)
+        {
+            return descriptorRange.index;
+        }
+
+        const std::scoped_lock lock(m_mutex);
+
+        const auto findFreeRange = [&]() {
+            return std::ranges::find_if(m_freeRanges,
+                                        [&](const DescriptorRange& freeRange) { return freeRange.count >= count; });
+        };
+
+        auto freeRange = findFreeRange();
+        if (freeRange == m_freeRanges.end() && !m_freeDescriptors.empty())
+        {
+            mergeFreeDescriptors();
+            freeRange = findFreeRange();
+        }
+
+        if (freeRange == m_freeRanges.end())
+        {
+            fatalError(std::format("Descriptor heap has no {} free contiguous persistent descriptors", count));
+        }
+
+        const uint32_t index = freeRange->index;
+
+        freeRange->index += count;
+        freeRange->count -= count;
+
+        if (freeRange->count == 0u)
+        {
+            m_freeRanges.erase(freeRange);
+        }
+
+        return index;
+    }
+
+    void DescriptorAllocator::free(const uint32_t index, const uint32_t count)
+    {
+        if (index == INVALID_INDEX_U32 || count == 0u)
+        {
+            return;
+        }
+
+        const std::scoped_lock lock(m_mutex);
+
+        if (count == 1u)
+        {
+            m_freeDescriptors.emplace_back(index);
+        }
+        else
+        {
+            addFreeRange(DescriptorRange{
+                .index = index,
+                .count = count,
+            });
+        }
+    }
+
+    uint32_t DescriptorAllocator::allocateTransient(const uint32_t count)
+    {
+        const uint32_t frameDescriptorOffset = m_frameDescriptorCount.fetch_add(count, std::memory_order_relaxed);
+
+        if (frameDescriptorOffset + count > m_transientDescriptorCountPerFrame)
+        {
+            fatalError("Descriptor heap is out of transient descriptors for the current frame");
+        }
+
+        return m_persistentDescriptorCount + m_frameIndex * m_transientDescriptorCountPerFrame + frameDescriptorOffset;
+    }
+
+    void DescriptorAllocator::resetFrame(const uint32_t frameIndex)
+    {
+        m_frameIndex = frameIndex;
+        m_frameDescriptorCount.store(0u, std::memory_order_relaxed);
+    }
+
+    DescriptorAllocator::DescriptorRange DescriptorAllocator::reserveFromCursor(const uint32_t count,
+                                                                                const bool allowPartial)
+    {
+        uint32_t cursor = m_persistentDescriptorCursor.load(std::memory_order_relaxed);
+        uint32_t reservedCount{};
+
+        do
+        {
+            const uint32_t remainingCount = m_persistentDescriptorCount - cursor;
+            if (remainingCount == 0u || (!allowPartial && remainingCount < count))
+            {
+                return DescriptorRange{};
+            }
+
+            reservedCount = std::min(count, remainingCount);
+        } while (!m_persistentDescriptorCursor.compare_exchange_weak(cursor, cursor + reservedCount,
+                                                                     std::memory_order_relaxed));
+
+        return DescriptorRange{
+            .index = cursor,
+            .count = reservedCount,
+        };
+    }
+
+    DescriptorAllocator::DescriptorRange DescriptorAllocator::reserveThreadCacheDescriptors()
+    {
+        if (const DescriptorRange descriptorRange = reserveFromCursor(THREAD_CACHE_DESCRIPTOR_COUNT, true);
+            descriptorRange.count != 0u)
+        {
+            return descriptorRange;
+        }
+
+        // The persistent region has been reserved entirely, so only freed descriptors are left.
+        const std::scoped_lock lock(m_mutex);
+
+        if (!m_freeRanges.empty())
+        {
+            DescriptorRange& freeRange = m_freeRanges.front();
+
+            const DescriptorRange descriptorRange = {
+                .index = freeRange.index,
+                .count = std::min(freeRange.count, THREAD_CACHE_DESCRIPTOR_COUNT),
+            };
+
+            freeRange.index += descriptorRange.count;
+            freeRange.count -= descriptorRange.count;
+
+            if (freeRange.count == 0u)
+            {
+                m_freeRanges.erase(m_freeRanges.begin());
+            }
+
+            return descriptorRange;
+        }
+
+        if (!m_freeDescriptors.empty())
+        {
+            const uint32_t index = m_freeDescriptors.back();
+            m_freeDescriptors.pop_back();
+
+            return DescriptorRange{
+                .index = index,
+                .count = 1u,
+            };
+        }
+
+        fatalError("Descriptor heap has no free persistent descriptors");
+
+        return DescriptorRange{};
+    }
+
+    void DescriptorAllocator::addFreeRange(const DescriptorRange& descriptorRange)
+    {
+        // First range that starts after the freed range.
+        auto nextRange = std::ranges::upper_bound(m_freeRanges, descriptorRange.index, {}, &DescriptorRange::index);
+
+        const bool isAdjacentToPrevious =
+            nextRange != m_freeRanges.begin() &&
+            std::prev(nextRange)->index + std::prev(nextRange)->count == descriptorRange.index;
+        const bool isAdjacentToNext =
+            nextRange != m_freeRanges.end() && descriptorRange.index + descriptorRange.count == nextRange->index;
+
+        if (isAdjacentToPrevious && isAdjacentToNext)
+        {
+            std::prev(nextRange)->count += descriptorRange.count + nextRange->count;
+            m_freeRanges.erase(nextRange);
+        }
+        else if (isAdjacentToPrevious)
+        {
+            std::prev(nextRange)->count += descriptorRange.count;
+        }
+        else if (isAdjacentToNext)
+        {
+            nextRange->index = descriptorRange.index;
+            nextRange->count += descriptorRange.count;
+        }
+        else
+        {
+            m_freeRanges.insert(nextRange, descriptorRange);
+        }
+    }
+
+    void DescriptorAllocator::mergeFreeDescriptors()
+    {
+        for (const uint32_t index : m_freeDescriptors)
+        {
+            addFreeRange(DescriptorRange{
+                .index = index,
+                .count = 1u,
+            });
+        }
+
+        m_freeDescriptors.clear();
+    }
+} // namespace helios::gfx
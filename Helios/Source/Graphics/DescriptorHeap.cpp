@@ -3,7 +3,11 @@
 namespace helios::gfx
 {
     DescriptorHeap::DescriptorHeap(ID3D12Device* const device, const D3D12_DESCRIPTOR_HEAP_TYPE descriptorHeapType,
-                                   const uint32_t descriptorCount, const std::wstring_view descriptorHeapName)
+                                   const uint32_t persistentDescriptorCount,
+                                   const std::wstring_view descriptorHeapName,
+                                   const uint32_t transientDescriptorCountPerFrame, const uint32_t frameCount)
+        : m_device(device), m_descriptorHeapType(descriptorHeapType),
+          m_descriptorAllocator(persistentDescriptorCount, transientDescriptorCountPerFrame)
     {
         const D3D12_DESCRIPTOR_HEAP_FLAGS descriptorHeapFlags = (descriptorHeapType == D3D12_DESCRIPTOR_HEAP_TYPE_DSV ||
                                                                  descriptorHeapType == D3D12_DESCRIPTOR_HEAP_TYPE_RTV)
@@ -12,7 +16,7 @@ namespace helios::gfx
 
         const D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {
             .Type = descriptorHeapType,
-            .NumDescriptors = descriptorCount,
+            .NumDescriptors = persistentDescriptorCount + transientDescriptorCountPerFrame * frameCount,
             .Flags = descriptorHeapFlags,
             .NodeMask = 0u,
         };
@@ -30,7 +34,100 @@ namespace helios::gfx
             .descriptorSize = m_descriptorSize,
         };
 
-        m_currentDescriptorHandle = m_descriptorHandleFromHeapStart;
+        // Shader visible heaps are written through a CPU only staging heap with the same layout.
+        if (descriptorHeapFlags == D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE)
+        {
+            const D3D12_DESCRIPTOR_HEAP_DESC stagingDescriptorHeapDesc = {
+                .Type = descriptorHeapType,
+                .NumDescriptors = descriptorHeapDesc.NumDescriptors,
+                .Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE,
+                .NodeMask = 0u,
+            };
+
+            throwIfFailed(
+                device->CreateDescriptorHeap(&stagingDescriptorHeapDesc, IID_PPV_ARGS(&m_stagingDescriptorHeap)));
+            m_stagingDescriptorHeap->SetName((std::wstring(descriptorHeapName) + L" Staging").c_str());
+
+            m_stagedDescriptorMasks =
+                std::vector<std::atomic<uint64_t>>((descriptorHeapDesc.NumDescriptors + 63u) / 64u);
+        }
+    }
+
+    D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeap::getStagingDescriptorHandle(const uint32_t index) const
+    {
+        D3D12_CPU_DESCRIPTOR_HANDLE handle = m_stagingDescriptorHeap
+                                                 ? m_stagingDescriptorHeap->GetCPUDescriptorHandleForHeapStart()
+                                                 : m_descriptorHandleFromHeapStart.cpuDescriptorHandle;
+        offsetDescriptor(handle, index);
+
+        return handle;
+    }
+
+    void DescriptorHeap::markDescriptorsStaged(const uint32_t index, const uint32_t count)
+    {
+        if (!m_stagingDescriptorHeap)
+        {
+            return;
+        }
+
+        for (const uint32_t descriptorIndex : std::views::iota(index, index + count))
+        {
+            m_stagedDescriptorMasks[descriptorIndex / 64u].fetch_or(1ull << (descriptorIndex % 64u),
+                                                                    std::memory_order_release);
+        }
+    }
+
+    void DescriptorHeap::copyStagedDescriptors()
+    {
+        if (!m_stagingDescriptorHeap)
+        {
+            return;
+        }
+
+        // Held for the whole copy, so that a thread that returns from this function knows that the descriptors staged
+        // before the call are in the shader visible heap (even if another thread copied them).
+        const std::scoped_lock lock(m_copyMutex);
+
+        // Contiguous staged descriptors are copied with a single call.
+        uint32_t rangeIndex{INVALID_INDEX_U32};
+        const auto copyRange = [&](const uint32_t endIndex) {
+            if (rangeIndex == INVALID_INDEX_U32)
+            {
+                return;
+            }
+
+            m_device->CopyDescriptorsSimple(endIndex - rangeIndex,
+                                            getDescriptorHandleFromIndex(rangeIndex).cpuDescriptorHandle,
+                                            getStagingDescriptorHandle(rangeIndex), m_descriptorHeapType);
+            rangeIndex = INVALID_INDEX_U32;
+        };
+
+        for (const uint32_t maskIndex : std::views::iota(0u, static_cast<uint32_t>(m_stagedDescriptorMasks.size())))
+        {
+            const uint64_t mask = m_stagedDescriptorMasks[maskIndex].exchange(0u, std::memory_order_acquire);
+
+            if (mask == 0u)
+            {
+                copyRange(maskIndex * 64u);
+                continue;
+            }
+
+            for (const uint32_t bit : std::views::iota(0u, 64u))
+            {
+                const uint32_t descriptorIndex = maskIndex * 64u + bit;
+
+                if ((mask >> bit) & 1u)
+                {
+                    rangeIndex = rangeIndex == INVALID_INDEX_U32 ? descriptorIndex : rangeIndex;
+                }
+                else
+                {
+                    copyRange(descriptorIndex);
+                }
+            }
+        }
+
+        copyRange(static_cast<uint32_t>(m_stagedDescriptorMasks.size()) * 64u);
     }
 
     DescriptorHandle DescriptorHeap::getDescriptorHandleFromIndex(const uint32_t index) const
@@ -48,11 +145,6 @@ namespace helios::gfx
             m_descriptorSize);
     }
 
-    uint32_t DescriptorHeap::getCurrentDescriptorIndex() const
-    {
-        return getDescriptorIndex(m_currentDescriptorHandle);
-    }
-
     void DescriptorHeap::offsetDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE& handle, const uint32_t offset) const
     {
         handle.ptr += m_descriptorSize * static_cast<unsigned long long>(offset);
@@ -68,9 +160,4 @@ namespace helios::gfx
         descriptorHandle.cpuDescriptorHandle.ptr += m_descriptorSize * static_cast<unsigned long long>(offset);
         descriptorHandle.gpuDescriptorHandle.ptr += m_descriptorSize * static_cast<unsigned long long>(offset);
     }
-
-    void DescriptorHeap::offsetCurrentHandle(const uint32_t offset)
-    {
-        offsetDescriptor(m_currentDescriptorHandle, offset);
-    }
 } // namespace helios::gfx
\ No newline at end of file
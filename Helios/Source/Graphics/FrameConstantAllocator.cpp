@@ -0,0 +1,72 @@
+#include "Graphics/FrameConstantAllocator.hpp"
+
+#include "Graphics/DescriptorHeap.hpp"
+#include "Graphics/MemoryAllocator.hpp"
+
+namespace helios::gfx
+{
+    namespace
+    {
+        constexpr uint64_t alignUp(const uint64_t value, const uint64_t alignment)
+        {
+            return (value + alignment - 1u) & ~(alignment - 1u);
+        }
+    } // namespace
+
+    FrameConstantAllocator::FrameConstantAllocator(ID3D12Device* const device, MemoryAllocator* const memoryAllocator,
+                                                   DescriptorHeap* const cbvSrvUavDescriptorHeap,
+                                                   const uint32_t frameCount)
+        : m_device(*device), m_cbvSrvUavDescriptorHeap(*cbvSrvUavDescriptorHeap)
+    {
+        m_bufferAllocation = memoryAllocator->createBufferResourceAllocation(
+            BufferCreationDesc{
+                .usage = BufferUsage::ConstantBuffer,
+                .name = L"Frame Constant Buffer",
+            },
+            ResourceCreationDesc::createBufferResourceCreationDesc(FRAME_CAPACITY * frameCount));
+
+        m_bufferCpuAddress = static_cast<std::byte*>(m_bufferAllocation.mappedPointer.value());
+        m_bufferGpuVirtualAddress = m_bufferAllocation.resource->GetGPUVirtualAddress();
+    }
+
+    FrameConstantBuffer FrameConstantAllocator::allocate(const void* data, const uint64_t sizeInBytes)
+    {
+        // Constant buffer views must be a multiple of 256 bytes in size (and placed at 256 byte aligned offsets).
+        const uint64_t alignedSizeInBytes = alignUp(sizeInBytes, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+        const std::scoped_lock lock(m_mutex);
+
+        if (m_frameOffset + alignedSizeInBytes > FRAME_CAPACITY)
+        {
+            fatalError("Frame constant allocator is out of memory for the current frame");
+        }
+
+        const uint64_t offset = m_frameIndex * FRAME_CAPACITY + m_frameOffset;
+        const uint32_t cbvIndex = m_cbvSrvUavDescriptorHeap.allocateTransientDescriptors();
+
+        m_frameOffset += alignedSizeInBytes;
+
+        std::memcpy(m_bufferCpuAddress + offset, data, sizeInBytes);
+
+        const D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {
+            .BufferLocation = m_bufferGpuVirtualAddress + offset,
+            .SizeInBytes = static_cast<UINT>(alignedSizeInBytes),
+        };
+
+        m_device.CreateConstantBufferView(&cbvDesc, m_cbvSrvUavDescriptorHeap.getStagingDescriptorHandle(cbvIndex));
+        m_cbvSrvUavDescriptorHeap.markDescriptorsStaged(cbvIndex);
+
+        return FrameConstantBuffer{
+            .cbvIndex = cbvIndex,
+            .gpuVirtualAddress = cbvDesc.BufferLocation,
+        };
+    }
+
+    void FrameConstantAllocator::resetFrame(const uint32_t frameIndex)
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        m_frameIndex = frameIndex;
+        m_frameOffset = 0u;
+    }
+} // namespace helios::gfx
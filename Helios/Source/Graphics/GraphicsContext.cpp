@@ -100,7 +100,7 @@ namespace helios::gfx
         const D3D12_INDEX_BUFFER_VIEW indexBufferView = {
             .BufferLocation = buffer.allocation.resource->GetGPUVirtualAddress(),
             .SizeInBytes = static_cast<UINT>(buffer.sizeInBytes),
-            .Format = DXGI_FORMAT_R16_UINT,
+            .Format = buffer.stride == sizeof(uint32_t) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT,
         };
 
         m_commandList->IASetIndexBuffer(&indexBufferView);
@@ -131,6 +131,11 @@ namespace helios::gfx
         m_commandList->SetComputeRoot32BitConstants(0u, NUMBER_32_BIT_CONSTANTS, renderResources, 0u);
     }
 
+    FrameConstantBuffer GraphicsContext::allocateFrameConstants(const void* data, const size_t sizeInBytes) const
+    {
+        return graphicsDevice.allocateFrameConstants(data, sizeInBytes);
+    }
+
     void GraphicsContext::setViewport(const D3D12_VIEWPORT& viewport) const
     {
         static D3D12_RECT scissorRect{.left = 0u, .top = 0u, .right = LONG_MAX, .bottom = LONG_MAX};
@@ -189,9 +194,10 @@ namespace helios::gfx
         m_commandList->CopyResource(destination, source);
     }
 
-    void GraphicsContext::drawInstanceIndexed(const uint32_t indicesCount, const uint32_t instanceCount) const
+    void GraphicsContext::drawInstanceIndexed(const uint32_t indicesCount, const uint32_t instanceCount,
+                                              const uint32_t startIndexLocation) const
     {
-        m_commandList->DrawIndexedInstanced(indicesCount, instanceCount, 0u, 0u, 0u);
+        m_commandList->DrawIndexedInstanced(indicesCount, instanceCount, startIndexLocation, 0u, 0u);
     }
 
     void GraphicsContext::drawIndexed(const uint32_t indicesCount, const uint32_t instanceCount) const
@@ -1,8 +1,8 @@
 #include "Graphics/GraphicsDevice.hpp"
 
 #include "Core/FileSystem.hpp"
-
-#include <stb_image.h>
+#include "Core/ImageDecoder.hpp"
+#include "Graphics/DDSFile.hpp"
 
 namespace helios::gfx
 {
@@ -18,7 +18,11 @@ namespace helios::gfx
 
     GraphicsDevice::~GraphicsDevice()
     {
+        // The direct queue waits for the uploads, so once it is flushed the copy queue is idle as well.
+        flushUploads();
+
         m_directCommandQueue->flush();
+        m_computeCommandQueue->flush();
     }
 
     void GraphicsDevice::initDeviceResources()
@@ -30,6 +34,8 @@ namespace helios::gfx
         initContexts();
         initBindlessRootSignature();
         initMipMapGenerator();
+        initTextureStreamer();
+        initTexturePool();
     }
 
     void GraphicsDevice::initSwapchainResources(const uint32_t windowWidth, const uint32_t windowHeight)
@@ -71,6 +77,8 @@ namespace helios::gfx
         throwIfFailed(swapChain1.As(&m_swapchain));
 
         m_currentFrameIndex = m_swapchain->GetCurrentBackBufferIndex();
+        m_frameConstantAllocator->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
+        m_cbvSrvUavDescriptorHeap->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
 
         createBackBufferRTVs();
     }
@@ -173,7 +181,8 @@ namespace helios::gfx
     {
         // Create descriptor heaps.
         m_cbvSrvUavDescriptorHeap = std::make_unique<DescriptorHeap>(
-            m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 10'000u, L"CBV SRV UAV Descriptor Heap");
+            m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 10'000u, L"CBV SRV UAV Descriptor Heap",
+            TRANSIENT_DESCRIPTORS_PER_FRAME, FRAMES_IN_FLIGHT);
 
         m_rtvDescriptorHeap = std::make_unique<DescriptorHeap>(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 50u,
                                                                L"RTV Descriptor Heap");
@@ -201,7 +210,10 @@ namespace helios::gfx
             }
         }
 
-        m_copyContext = std::make_unique<CopyContext>(this);
+        m_uploadRingBuffer =
+            std::make_unique<UploadRingBuffer>(this, m_memoryAllocator.get(), m_copyCommandQueue.get());
+        m_frameConstantAllocator = std::make_unique<FrameConstantAllocator>(
+            m_device.Get(), m_memoryAllocator.get(), m_cbvSrvUavDescriptorHeap.get(), FRAMES_IN_FLIGHT);
         m_computeContextQueue.push(std::make_unique<ComputeContext>(this));
     }
 
@@ -216,9 +228,23 @@ namespace helios::gfx
         m_mipMapGenerator = std::make_unique<MipMapGenerator>(this);
     }
 
+    void GraphicsDevice::initTextureStreamer()
+    {
+        m_textureStreamer = std::make_unique<TextureStreamer>(this);
+    }
+
+    void GraphicsDevice::initTexturePool()
+    {
+        m_texturePool = std::make_unique<TexturePool>();
+    }
+
     void GraphicsDevice::createBackBufferRTVs()
     {
-        DescriptorHandle rtvHandle = m_rtvDescriptorHeap->getDescriptorHandleFromStart();
+        // The RTV's are allocated once, and rewritten when the swapchain is resized.
+        if (m_backBufferRtvIndex == INVALID_INDEX_U32)
+        {
+            m_backBufferRtvIndex = m_rtvDescriptorHeap->allocateDescriptors(FRAMES_IN_FLIGHT);
+        }
 
         // Create Backbuffer render target views.
         for (const uint32_t i : std::views::iota(0u, FRAMES_IN_FLIGHT))
@@ -226,18 +252,13 @@ namespace helios::gfx
             wrl::ComPtr<ID3D12Resource> backBuffer{};
             throwIfFailed(m_swapchain->GetBuffer(i, IID_PPV_ARGS(&backBuffer)));
 
-            m_device->CreateRenderTargetView(backBuffer.Get(), nullptr, rtvHandle.cpuDescriptorHandle);
-
             m_backBuffers[i].allocation.resource = backBuffer;
             m_backBuffers[i].allocation.resource->SetName(L"SwapChain BackBuffer");
-            m_backBuffers[i].rtvIndex = m_rtvDescriptorHeap->getDescriptorIndex(rtvHandle);
+            m_backBuffers[i].rtvIndex = m_backBufferRtvIndex + i;
 
-            m_rtvDescriptorHeap->offsetDescriptor(rtvHandle);
-        }
-
-        if (!m_isInitialized)
-        {
-            m_rtvDescriptorHeap->offsetCurrentHandle(FRAMES_IN_FLIGHT);
+            m_device->CreateRenderTargetView(
+                backBuffer.Get(), nullptr,
+                m_rtvDescriptorHeap->getDescriptorHandleFromIndex(m_backBuffers[i].rtvIndex).cpuDescriptorHandle);
         }
     }
 
@@ -259,6 +280,11 @@ namespace helios::gfx
 
     void GraphicsDevice::executeAndFlushComputeContext(std::unique_ptr<ComputeContext>&& computeContext)
     {
+        // The compute work may read resources whose uploads have not been submitted yet (or whose descriptors are
+        // still staged).
+        flushUploads();
+        copyStagedDescriptors();
+
         // Execute compute context and push to the queue.
         std::array<const Context*, 1u> contexts = {computeContext.get()};
         m_computeCommandQueue->executeContext(contexts);
@@ -267,12 +293,56 @@ namespace helios::gfx
         m_computeContextQueue.emplace(std::move(computeContext));
     }
 
+    void GraphicsDevice::executeContexts(const std::span<const Context* const> contexts)
+    {
+        copyStagedDescriptors();
+
+        m_directCommandQueue->executeContext(contexts);
+    }
+
+    void GraphicsDevice::copyStagedDescriptors()
+    {
+        m_cbvSrvUavDescriptorHeap->copyStagedDescriptors();
+        m_samplerDescriptorHeap->copyStagedDescriptors();
+    }
+
+    void GraphicsDevice::flushUploads()
+    {
+        std::scoped_lock<std::recursive_mutex> resourceLockGuard(m_resourceMutex);
+
+        const uint64_t uploadFenceValue = m_uploadRingBuffer->submit();
+        if (uploadFenceValue > m_uploadFenceValue)
+        {
+            m_directCommandQueue->waitForQueue(*m_copyCommandQueue, uploadFenceValue);
+            m_computeCommandQueue->waitForQueue(*m_copyCommandQueue, uploadFenceValue);
+
+            m_uploadFenceValue = uploadFenceValue;
+        }
+    }
+
+    UploadTicket GraphicsDevice::getLatestUploadTicket() const
+    {
+        return m_uploadRingBuffer->getLatestUploadTicket();
+    }
+
+    bool GraphicsDevice::isUploadComplete(const UploadTicket& uploadTicket) const
+    {
+        return m_uploadRingBuffer->isUploadComplete(uploadTicket);
+    }
+
+    void GraphicsDevice::waitForUpload(const UploadTicket& uploadTicket) const
+    {
+        m_uploadRingBuffer->waitForUpload(uploadTicket);
+    }
+
     void GraphicsDevice::beginFrame()
     {
         for (auto& context : m_perFrameGraphicsContexts[m_currentFrameIndex])
         {
             context->reset();
         }
+
+        flushUploads();
     }
 
     void GraphicsDevice::present()
@@ -282,17 +352,162 @@ namespace helios::gfx
 
     void GraphicsDevice::endFrame()
     {
+        // The direct queue waits for the uploads recorded during the frame, so that the signal below also covers them
+        // (see deferRelease).
+        flushUploads();
+
         m_fenceValues[m_currentFrameIndex].directQueueFenceValue = m_directCommandQueue->signal();
 
         m_currentFrameIndex = m_swapchain->GetCurrentBackBufferIndex();
 
         m_directCommandQueue->waitForFenceValue(m_fenceValues[m_currentFrameIndex].directQueueFenceValue);
+
+        // The frame that last used the constants (and transient descriptors) of this frame index has completed (see
+        // FrameConstantAllocator).
+        m_frameConstantAllocator->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
+        m_cbvSrvUavDescriptorHeap->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
+
+        releaseCompletedResources();
+    }
+
+    void GraphicsDevice::deferRelease(Allocation&& allocation) const
+    {
+        deferRelease(DeferredRelease{
+            .allocation = std::move(allocation),
+        });
+    }
+
+    void GraphicsDevice::deferRelease(const DescriptorRange& descriptorRange) const
+    {
+        if (descriptorRange.index == INVALID_INDEX_U32)
+        {
+            return;
+        }
+
+        deferRelease(DeferredRelease{
+            .descriptorRanges = {descriptorRange},
+        });
+    }
+
+    void GraphicsDevice::deferRelease(Buffer&& buffer) const
+    {
+        DeferredRelease deferredRelease{
+            .allocation = std::move(buffer.allocation),
+        };
+
+        for (const uint32_t descriptorIndex : {buffer.srvIndex, buffer.uavIndex, buffer.cbvIndex})
+        {
+            if (descriptorIndex != INVALID_INDEX_U32)
+            {
+                deferredRelease.descriptorRanges.emplace_back(DescriptorRange{
+                    .descriptorHeap = m_cbvSrvUavDescriptorHeap.get(),
+                    .index = descriptorIndex,
+                });
+            }
+        }
+
+        buffer = {};
+
+        deferRelease(std::move(deferredRelease));
+    }
+
+    void GraphicsDevice::deferRelease(Texture&& texture) const
+    {
+        DeferredRelease deferredRelease{
+            .allocation = std::move(texture.allocation),
+        };
+
+        const std::array descriptorRanges = {
+            DescriptorRange{m_cbvSrvUavDescriptorHeap.get(), texture.srvIndex, texture.srvCount},
+            DescriptorRange{m_cbvSrvUavDescriptorHeap.get(), texture.uavIndex, texture.uavCount},
+            DescriptorRange{m_rtvDescriptorHeap.get(), texture.rtvIndex, 1u},
+            DescriptorRange{m_dsvDescriptorHeap.get(), texture.dsvIndex, 1u},
+        };
+
+        for (const DescriptorRange& descriptorRange : descriptorRanges)
+        {
+            if (descriptorRange.index != INVALID_INDEX_U32 && descriptorRange.count != 0u)
+            {
+                deferredRelease.descriptorRanges.emplace_back(descriptorRange);
+            }
+        }
+
+        texture = {};
+
+        deferRelease(std::move(deferredRelease));
+    }
+
+    void GraphicsDevice::releaseTexture(const TextureHandle textureHandle) const
+    {
+        if (std::optional<Texture> texture = m_texturePool->removeReference(textureHandle))
+        {
+            deferRelease(std::move(*texture));
+        }
+    }
+
+    void GraphicsDevice::deferRelease(DeferredRelease&& deferredRelease) const
+    {
+        if (!deferredRelease.allocation.resource && deferredRelease.descriptorRanges.empty())
+        {
+            return;
+        }
+
+        const std::scoped_lock lock(m_deferredReleaseMutex);
+
+        // The direct queue is signaled at the end of every frame, while the compute and copy queues are only signaled
+        // when work is submitted to them (which may never happen again). Work on those queues is always signaled right
+        // after it is executed, so the last signaled values cover it. Uploads that have not been submitted yet are
+        // submitted before the end of frame signal, which the direct queue only reaches once they have completed (see
+        // endFrame).
+        deferredRelease.fenceValues = {
+            .directQueueFenceValue = m_directCommandQueue->getNextFenceValue(),
+            .computeQueueFenceValue = m_computeCommandQueue->getLastSignaledFenceValue(),
+            .copyQueueFenceValue = m_copyCommandQueue->getLastSignaledFenceValue(),
+        };
+
+        m_deferredReleases.emplace_back(std::move(deferredRelease));
+    }
+
+    void GraphicsDevice::releaseCompletedResources()
+    {
+        const std::scoped_lock lock(m_deferredReleaseMutex);
+
+        // Releases are queued in order, so the fence values only increase along the queue.
+        while (!m_deferredReleases.empty())
+        {
+            const FenceValues& fenceValues = m_deferredReleases.front().fenceValues;
+
+            if (!m_directCommandQueue->isFenceComplete(fenceValues.directQueueFenceValue) ||
+                !m_computeCommandQueue->isFenceComplete(fenceValues.computeQueueFenceValue) ||
+                !m_copyCommandQueue->isFenceComplete(fenceValues.copyQueueFenceValue))
+            {
+                break;
+            }
+
+            for (const DescriptorRange& descriptorRange : m_deferredReleases.front().descriptorRanges)
+            {
+                descriptorRange.descriptorHeap->freeDescriptors(descriptorRange.index, descriptorRange.count);
+            }
+
+            m_deferredReleases.pop_front();
+        }
+    }
+
+    VideoMemoryBudget GraphicsDevice::getVideoMemoryBudget() const
+    {
+        return m_memoryAllocator->getVideoMemoryBudget();
+    }
+
+    FrameConstantBuffer GraphicsDevice::allocateFrameConstants(const void* data, const size_t sizeInBytes) const
+    {
+        return m_frameConstantAllocator->allocate(data, sizeInBytes);
     }
 
     void GraphicsDevice::resizeWindow(const uint32_t windowWidth, const uint32_t windowHeight)
     {
+        // The swap chain back buffers can only be resized once no frame in flight uses them (other resources do not
+        // need the queues to be flushed, see deferRelease).
         m_directCommandQueue->flush();
-        m_copyCommandQueue->flush();
 
         // All swapchain back buffers need to be released.
         for (const uint32_t i : std::views::iota(0u, FRAMES_IN_FLIGHT))
@@ -307,7 +522,10 @@ namespace helios::gfx
         throwIfFailed(m_swapchain->ResizeBuffers(FRAMES_IN_FLIGHT, windowWidth, windowHeight,
                                                  m_swapchainBackBufferFormat, swapchainDesc.Flags));
 
+        // The direct queue is idle, so the constants of the new frame index are no longer used.
         m_currentFrameIndex = m_swapchain->GetCurrentBackBufferIndex();
+        m_frameConstantAllocator->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
+        m_cbvSrvUavDescriptorHeap->resetFrame(static_cast<uint32_t>(m_currentFrameIndex));
 
         createBackBufferRTVs();
     }
@@ -320,54 +538,72 @@ namespace helios::gfx
         // input parameter non const, this approach of making a local copy is taken.
         TextureCreationDesc textureCreationDesc = paramTextureCreationDesc;
 
-        textureCreationDesc.path = core::FileSystem::getFullPath(textureCreationDesc.path);
-
-        int32_t componentCount = 4;
-        int32_t width{};
-        int32_t height{};
+        // Texture paths are relative to the root directory, unless they are already full paths (as for the textures
+        // cooked by the TextureCache).
+        if (textureCreationDesc.path.find(core::FileSystem::getFullPath(L"")) == std::wstring::npos)
+        {
+            textureCreationDesc.path = core::FileSystem::getFullPath(textureCreationDesc.path);
+        }
 
-        // For use only by HDR textures (mostly for Cube Map equirectangular textures).
-        float* hdrTextureData{nullptr};
+        uint32_t width{};
+        uint32_t height{};
 
-        // For use by textures that are non HDR and going to be loaded using stbi.
-        void* textureData{(void*)(data)};
+        // Images loaded from a path are owned by decodedImage, and released once they have been uploaded (i.e when
+        // this function returns). Similarly, container files are memory mapped by ddsFile until then.
+        core::DecodedImage decodedImage{};
+        std::optional<DDSFile> ddsFile{};
+        const void* textureData{data};
 
         if (textureCreationDesc.usage == TextureUsage::TextureFromData)
         {
             width = textureCreationDesc.width;
             height = textureCreationDesc.height;
         }
-        else if (textureCreationDesc.usage == TextureUsage::TextureFromPath)
+        else if (textureCreationDesc.usage == TextureUsage::TextureFromContainer)
         {
-            textureData =
-                stbi_load(wStringToString(textureCreationDesc.path).c_str(), &width, &height, nullptr, componentCount);
-
-            if (!textureData)
+            ddsFile = DDSFile::open(textureCreationDesc.path);
+            if (!ddsFile.has_value())
             {
-                fatalError(
-                    std::format("Failed to load texture from path : {}.", wStringToString(textureCreationDesc.path)));
+                fatalError(std::format("Failed to load texture container from path : {}.",
+                                       wStringToString(textureCreationDesc.path)));
             }
 
+            const DDSTextureDesc& ddsTextureDesc = ddsFile->getTextureDesc();
+
+            // Mip levels more detailed than mostDetailedMip are not loaded.
+            textureCreationDesc.mostDetailedMip =
+                std::min(textureCreationDesc.mostDetailedMip, ddsTextureDesc.mipLevels - 1u);
+
+            const SubresourceLayout& mostDetailedMipLayout =
+                ddsFile->getSubresourceLayouts()[textureCreationDesc.mostDetailedMip];
+
+            textureData = ddsFile->getData();
+            width = mostDetailedMipLayout.width;
+            height = mostDetailedMipLayout.height;
+
+            textureCreationDesc.format = ddsTextureDesc.format;
             textureCreationDesc.width = width;
             textureCreationDesc.height = height;
+            textureCreationDesc.mipLevels = ddsTextureDesc.mipLevels - textureCreationDesc.mostDetailedMip;
         }
-        else if (textureCreationDesc.usage == TextureUsage::HDRTextureFromPath)
+        else if (textureCreationDesc.usage == TextureUsage::TextureFromPath ||
+                 textureCreationDesc.usage == TextureUsage::HDRTextureFromPath)
         {
-            hdrTextureData =
-                stbi_loadf(wStringToString(textureCreationDesc.path).c_str(), &width, &height, nullptr, componentCount);
+            // HDR textures are mostly used for Cube Map equirectangular textures.
+            const std::string texturePath = wStringToString(textureCreationDesc.path);
 
-            if (!hdrTextureData)
-            {
-                fatalError(
-                    std::format("Failed to load texture from path : {}.", wStringToString(textureCreationDesc.path)));
-            }
+            decodedImage = textureCreationDesc.usage == TextureUsage::HDRTextureFromPath
+                               ? core::ImageDecoder::get().decodeHDR(texturePath)
+                               : core::ImageDecoder::get().decode(texturePath);
+
+            textureData = decodedImage.getData();
+            width = decodedImage.getWidth();
+            height = decodedImage.getHeight();
 
             textureCreationDesc.width = width;
             textureCreationDesc.height = height;
         }
 
-        std::scoped_lock<std::recursive_mutex> resourceLockGuard(m_resourceMutex);
-
         // Create a Allocation for the texture (GPU only memory).
         texture.allocation = m_memoryAllocator->createTextureResourceAllocation(textureCreationDesc);
 
@@ -398,58 +634,37 @@ namespace helios::gfx
         break;
         }
 
-        // If texture created from file, load data (using stb_image currently) into a upload buffer and copy sub
-        // resource data from a upload buffer into the GPU only texture.
-        if (textureData || hdrTextureData)
+        // If texture created from file, stage the data (decoded using stb_image, or read from the container) in the
+        // upload ring buffer, and record a copy of all subresources into the GPU only texture.
+        if (textureData)
         {
-            // Create upload buffer.
-            const BufferCreationDesc uploadBufferCreationDesc = {
-                .usage = BufferUsage::UploadBuffer,
-                .name = L"Upload buffer - " + std::wstring(textureCreationDesc.name),
-            };
-
-            const UINT64 uploadBufferSize = GetRequiredIntermediateSize(texture.allocation.resource.Get(), 0, 1);
-
-            const ResourceCreationDesc resourceCreationDesc =
-                ResourceCreationDesc::createBufferResourceCreationDesc(uploadBufferSize);
-
-            Allocation uploadAllocation =
-                m_memoryAllocator->createBufferResourceAllocation(uploadBufferCreationDesc, resourceCreationDesc);
+            // Specify data to copy. Containers provide the data of every mip level, all other textures only of mip 0
+            // (the remaining mips are generated on the GPU).
+            std::vector<D3D12_SUBRESOURCE_DATA> textureSubresourceData{};
 
-            // Specify data to copy.
-            D3D12_SUBRESOURCE_DATA textureSubresourceData{};
-
-            if (textureCreationDesc.usage == TextureUsage::HDRTextureFromPath)
+            if (ddsFile.has_value())
             {
-                textureSubresourceData = {
-                    .pData = hdrTextureData,
-                    .RowPitch = width * textureCreationDesc.bytesPerPixel,
-                    .SlicePitch = width * height * textureCreationDesc.bytesPerPixel,
-                };
+                for (const SubresourceLayout& subresourceLayout :
+                     ddsFile->getSubresourceLayouts().subspan(textureCreationDesc.mostDetailedMip))
+                {
+                    textureSubresourceData.emplace_back(D3D12_SUBRESOURCE_DATA{
+                        .pData = ddsFile->getData() + subresourceLayout.offset,
+                        .RowPitch = static_cast<LONG_PTR>(subresourceLayout.rowPitch),
+                        .SlicePitch = static_cast<LONG_PTR>(subresourceLayout.getSizeInBytes()),
+                    });
+                }
             }
-            else // TexureUsage:: TextureFromPath (non HDR).
+            else
             {
-                textureSubresourceData = {
+                textureSubresourceData.emplace_back(D3D12_SUBRESOURCE_DATA{
                     .pData = textureData,
                     .RowPitch = width * textureCreationDesc.bytesPerPixel,
                     .SlicePitch = width * height * textureCreationDesc.bytesPerPixel,
-                };
+                });
             }
 
-            // Use the copy context and execute UpdateSubresources functions on the copy command queue.
-            m_copyContext->reset();
-
-            UpdateSubresources(m_copyContext->getCommandList(), texture.allocation.resource.Get(),
-                               uploadAllocation.resource.Get(), 0u, 0u, 1u, &textureSubresourceData);
-
-            const std::array<helios::gfx::Context* const, 1u> contexts = {
-                m_copyContext.get(),
-            };
-
-            m_copyCommandQueue->executeContext(contexts);
-            m_copyCommandQueue->flush();
-
-            uploadAllocation.reset();
+            texture.uploadTicket =
+                m_uploadRingBuffer->uploadTexture(texture.allocation.resource.Get(), textureSubresourceData);
         }
 
         // Create descriptors.
@@ -491,7 +706,19 @@ namespace helios::gfx
             };
         }
 
-        texture.srvIndex = createSrv(srvCreationDesc, texture.allocation.resource.Get());
+        // UAV textures also have a SRV per mip level, which follow the SRV of the texture. SRV's written to a given
+        // index (see TextureCreationDesc::srvIndex) are owned by the caller, and are not released with the texture.
+        if (textureCreationDesc.srvIndex != INVALID_INDEX_U32)
+        {
+            texture.srvIndex = textureCreationDesc.srvIndex;
+        }
+        else
+        {
+            texture.srvCount = textureCreationDesc.usage == TextureUsage::UAVTexture ? mipLevels : 1u;
+            texture.srvIndex = m_cbvSrvUavDescriptorHeap->allocateDescriptors(texture.srvCount);
+        }
+
+        texture.srvIndex = createSrv(srvCreationDesc, texture.allocation.resource.Get(), texture.srvIndex);
 
         // Create SRV's for mip levels. Can be accessed by in code by texture.srvIndex + i.
         // Only doing this for textures which are specified as UAV textures.
@@ -499,7 +726,7 @@ namespace helios::gfx
         {
             for (const uint32_t i : std::views::iota(1u, textureCreationDesc.mipLevels))
             {
-                const uint32_t srvIndex = createSrv(
+                static_cast<void>(createSrv(
                     gfx::SrvCreationDesc{
                         .srvDesc =
                             {
@@ -513,7 +740,7 @@ namespace helios::gfx
                                     },
                             },
                     },
-                    texture.allocation.resource.Get());
+                    texture.allocation.resource.Get(), texture.srvIndex + i));
             }
         }
 
@@ -550,11 +777,13 @@ namespace helios::gfx
             texture.rtvIndex = createRtv(rtvCreationDesc, texture.allocation.resource.Get());
         }
 
-        // Create UAV's is applicable.
-        if (textureCreationDesc.usage != TextureUsage::DepthStencil)
+        // Create UAV's is applicable (block compressed textures loaded from containers can not be used as UAV's).
+        if (textureCreationDesc.usage != TextureUsage::DepthStencil &&
+            textureCreationDesc.usage != TextureUsage::TextureFromContainer)
         {
-            // The Texture will hold the index to only the first uav, but they will be contiguous in nature
-            // since only single large descriptor heap is used for each descriptor type.
+            // The Texture will hold the index to only the first uav, but they are allocated as a contiguous range.
+            texture.uavCount = mipLevels;
+            texture.uavIndex = m_cbvSrvUavDescriptorHeap->allocateDescriptors(texture.uavCount);
 
             if (textureCreationDesc.depthOrArraySize > 1u)
             {
@@ -563,7 +792,7 @@ namespace helios::gfx
                 {
                     // uavIndex will not be directly accesible to user, user must add the index to texture.uav
                     // index to retrive it.
-                    const uint32_t uavIndex = createUav(
+                    static_cast<void>(createUav(
                         UavCreationDesc{
                             .uavDesc =
                                 {
@@ -577,12 +806,7 @@ namespace helios::gfx
                                         },
                                 },
                         },
-                        texture.allocation.resource.Get());
-
-                    if (i == 0u)
-                    {
-                        texture.uavIndex = uavIndex;
-                    }
+                        texture.allocation.resource.Get(), texture.uavIndex + i));
                 }
             }
             else // Texture is just a Texture 2D.
@@ -592,7 +816,7 @@ namespace helios::gfx
                 {
                     // uavIndex will not be directly accesible to user, user must add the index to texture.uav
                     // index to retrive it.
-                    const uint32_t uavIndex = createUav(
+                    static_cast<void>(createUav(
                         UavCreationDesc{
                             .uavDesc =
                                 {
@@ -605,18 +829,16 @@ namespace helios::gfx
                                         },
                                 },
                         },
-                        texture.allocation.resource.Get());
-
-                    if (i == 0u)
-                    {
-                        texture.uavIndex = uavIndex;
-                    }
+                        texture.allocation.resource.Get(), texture.uavIndex + i));
                 }
             }
         }
 
-        // Generate mip maps.
-        m_mipMapGenerator->generateMips(texture);
+        // Generate mip maps (containers already store all mip levels).
+        if (textureCreationDesc.usage != TextureUsage::TextureFromContainer)
+        {
+            m_mipMapGenerator->generateMips(texture);
+        }
 
         return texture;
     }
@@ -625,12 +847,11 @@ namespace helios::gfx
     {
         Sampler sampler{};
 
-        sampler.samplerIndex = m_samplerDescriptorHeap->getCurrentDescriptorIndex();
-        gfx::DescriptorHandle samplerDescriptorHandle = m_samplerDescriptorHeap->getCurrentDescriptorHandle();
+        sampler.samplerIndex = m_samplerDescriptorHeap->allocateDescriptors();
 
-        m_device->CreateSampler(&samplerCreationDesc.samplerDesc, samplerDescriptorHandle.cpuDescriptorHandle);
-
-        m_samplerDescriptorHeap->offsetCurrentHandle();
+        m_device->CreateSampler(&samplerCreationDesc.samplerDesc,
+                                m_samplerDescriptorHeap->getStagingDescriptorHandle(sampler.samplerIndex));
+        m_samplerDescriptorHeap->markDescriptorsStaged(sampler.samplerIndex);
 
         return sampler;
     }
@@ -653,61 +874,59 @@ namespace helios::gfx
 
     uint32_t GraphicsDevice::createCbv(const CbvCreationDesc& cbvCreationDesc) const
     {
-        const uint32_t cbvIndex = m_cbvSrvUavDescriptorHeap->getCurrentDescriptorIndex();
+        const uint32_t cbvIndex = m_cbvSrvUavDescriptorHeap->allocateDescriptors();
 
         m_device->CreateConstantBufferView(&cbvCreationDesc.cbvDesc,
-                                           m_cbvSrvUavDescriptorHeap->getCurrentDescriptorHandle().cpuDescriptorHandle);
-
-        m_cbvSrvUavDescriptorHeap->offsetCurrentHandle();
+                                           m_cbvSrvUavDescriptorHeap->getStagingDescriptorHandle(cbvIndex));
+        m_cbvSrvUavDescriptorHeap->markDescriptorsStaged(cbvIndex);
 
         return cbvIndex;
     }
 
-    uint32_t GraphicsDevice::createSrv(const SrvCreationDesc& srvCreationDesc, ID3D12Resource* const resource) const
+    uint32_t GraphicsDevice::createSrv(const SrvCreationDesc& srvCreationDesc, ID3D12Resource* const resource,
+                                       const uint32_t descriptorIndex) const
     {
-        const uint32_t srvIndex = m_cbvSrvUavDescriptorHeap->getCurrentDescriptorIndex();
+        const uint32_t srvIndex =
+            descriptorIndex != INVALID_INDEX_U32 ? descriptorIndex : m_cbvSrvUavDescriptorHeap->allocateDescriptors();
 
         m_device->CreateShaderResourceView(resource, &srvCreationDesc.srvDesc,
-                                           m_cbvSrvUavDescriptorHeap->getCurrentDescriptorHandle().cpuDescriptorHandle);
-
-        m_cbvSrvUavDescriptorHeap->offsetCurrentHandle();
+                                           m_cbvSrvUavDescriptorHeap->getStagingDescriptorHandle(srvIndex));
+        m_cbvSrvUavDescriptorHeap->markDescriptorsStaged(srvIndex);
 
         return srvIndex;
     }
 
-    uint32_t GraphicsDevice::createUav(const UavCreationDesc& uavCreationDesc, ID3D12Resource* const resource) const
+    uint32_t GraphicsDevice::createUav(const UavCreationDesc& uavCreationDesc, ID3D12Resource* const resource,
+                                       const uint32_t descriptorIndex) const
     {
-        const uint32_t uavIndex = m_cbvSrvUavDescriptorHeap->getCurrentDescriptorIndex();
-
-        m_device->CreateUnorderedAccessView(
-            resource, nullptr, &uavCreationDesc.uavDesc,
-            m_cbvSrvUavDescriptorHeap->getCurrentDescriptorHandle().cpuDescriptorHandle);
+        const uint32_t uavIndex =
+            descriptorIndex != INVALID_INDEX_U32 ? descriptorIndex : m_cbvSrvUavDescriptorHeap->allocateDescriptors();
 
-        m_cbvSrvUavDescriptorHeap->offsetCurrentHandle();
+        m_device->CreateUnorderedAccessView(resource, nullptr, &uavCreationDesc.uavDesc,
+                                            m_cbvSrvUavDescriptorHeap->getStagingDescriptorHandle(uavIndex));
+        m_cbvSrvUavDescriptorHeap->markDescriptorsStaged(uavIndex);
 
         return uavIndex;
     }
 
     uint32_t GraphicsDevice::createRtv(const RtvCreationDesc& rtvCreationDesc, ID3D12Resource* const resource) const
     {
-        const uint32_t rtvIndex = m_rtvDescriptorHeap->getCurrentDescriptorIndex();
+        const uint32_t rtvIndex = m_rtvDescriptorHeap->allocateDescriptors();
 
-        m_device->CreateRenderTargetView(resource, &rtvCreationDesc.rtvDesc,
-                                         m_rtvDescriptorHeap->getCurrentDescriptorHandle().cpuDescriptorHandle);
-
-        m_rtvDescriptorHeap->offsetCurrentHandle();
+        m_device->CreateRenderTargetView(
+            resource, &rtvCreationDesc.rtvDesc,
+            m_rtvDescriptorHeap->getDescriptorHandleFromIndex(rtvIndex).cpuDescriptorHandle);
 
         return rtvIndex;
     }
 
     uint32_t GraphicsDevice::createDsv(const DsvCreationDesc& dsvCreationDesc, ID3D12Resource* const resource) const
     {
-        const uint32_t dsvIndex = m_dsvDescriptorHeap->getCurrentDescriptorIndex();
-
-        m_device->CreateDepthStencilView(resource, &dsvCreationDesc.dsvDesc,
-                                         m_dsvDescriptorHeap->getCurrentDescriptorHandle().cpuDescriptorHandle);
+        const uint32_t dsvIndex = m_dsvDescriptorHeap->allocateDescriptors();
 
-        m_dsvDescriptorHeap->offsetCurrentHandle();
+        m_device->CreateDepthStencilView(
+            resource, &dsvCreationDesc.dsvDesc,
+            m_dsvDescriptorHeap->getDescriptorHandleFromIndex(dsvIndex).cpuDescriptorHandle);
 
         return dsvIndex;
     }
@@ -27,6 +27,7 @@ namespace helios::gfx
         switch (bufferCreationDesc.usage)
         {
         case BufferUsage::UploadBuffer:
+        case BufferUsage::DynamicStructuredBuffer:
         case BufferUsage::ConstantBuffer: {
             // GenericRead implies readable data from the GPU memory. Required resourceState for upload heaps.
             // UploadHeap : CPU writable access, GPU readable access.
@@ -104,17 +105,21 @@ namespace helios::gfx
                 },
         };
 
-        // Clamp the mip level.
-        if (resourceCreationDesc.resourceDesc.MipLevels >= resourceCreationDesc.resourceDesc.Width)
+        // Clamp the mip level. Containers always store a valid mip chain, which must be created as is (as the data of
+        // every mip level is uploaded).
+        if (textureCreationDesc.usage != TextureUsage::TextureFromContainer)
         {
-            resourceCreationDesc.resourceDesc.MipLevels =
-                static_cast<UINT16>(resourceCreationDesc.resourceDesc.Width - 1);
-        }
-
-        if (resourceCreationDesc.resourceDesc.MipLevels >= resourceCreationDesc.resourceDesc.Height)
-        {
-            resourceCreationDesc.resourceDesc.MipLevels =
-                static_cast<UINT16>(resourceCreationDesc.resourceDesc.Height - 1);
+            if (resourceCreationDesc.resourceDesc.MipLevels >= resourceCreationDesc.resourceDesc.Width)
+            {
+                resourceCreationDesc.resourceDesc.MipLevels =
+                    static_cast<UINT16>(resourceCreationDesc.resourceDesc.Width - 1);
+            }
+
+            if (resourceCreationDesc.resourceDesc.MipLevels >= resourceCreationDesc.resourceDesc.Height)
+            {
+                resourceCreationDesc.resourceDesc.MipLevels =
+                    static_cast<UINT16>(resourceCreationDesc.resourceDesc.Height - 1);
+            }
         }
 
         const uint32_t mipLevels = resourceCreationDesc.resourceDesc.MipLevels;
@@ -158,6 +163,12 @@ namespace helios::gfx
             resourceCreationDesc.resourceDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
         }
         break;
+
+        case TextureUsage::TextureFromContainer: {
+            // Block compressed textures can not be used as UAV's (their mip levels are stored in the container).
+            resourceCreationDesc.resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+        }
+        break;
         };
 
         std::optional<D3D12_CLEAR_VALUE> optimizedClearValue{};
@@ -205,4 +216,17 @@ namespace helios::gfx
 
         return allocation;
     }
+
+    VideoMemoryBudget MemoryAllocator::getVideoMemoryBudget()
+    {
+        D3D12MA::Budget localBudget{};
+
+        std::lock_guard<std::recursive_mutex> resourceAllocationLockGuard(m_resourceAllocationMutex);
+        m_allocator->GetBudget(&localBudget, nullptr);
+
+        return VideoMemoryBudget{
+            .usageBytes = localBudget.UsageBytes,
+            .budgetBytes = localBudget.BudgetBytes,
+        };
+    }
 } // namespace helios::gfx
\ No newline at end of file
@@ -125,5 +125,8 @@ namespace helios::gfx
 
             srcMipLevel += static_cast<uint32_t>(mipCount);
         }
+
+        // The compute queue has been flushed, so the SRV is no longer used.
+        graphicsDevice.getCbvSrvUavDescriptorHeap()->freeDescriptors(sourceMipSrvIndex);
     }
 } // namespace helios::gfx
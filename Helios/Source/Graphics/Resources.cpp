@@ -18,17 +18,10 @@ namespace helios::gfx
             return *this;
         }
 
-        // Clear state of current object.
-        resource->Release();
-        allocation->Release();
-
-        if (other.mappedPointer.has_value())
-        {
-            mappedPointer = other.mappedPointer;
-        }
-
+        // The ComPtr's release the current objects (and add a reference to the other ones).
         resource = other.resource;
         allocation = other.allocation;
+        mappedPointer = other.mappedPointer;
 
         return *this;
     }
@@ -146,4 +139,83 @@ namespace helios::gfx
         break;
         }
     }
+
+    bool Texture::isBlockCompressed(const DXGI_FORMAT format)
+    {
+        switch (getNonSRGBFormat(format))
+        {
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC2_UNORM:
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC4_UNORM:
+        case DXGI_FORMAT_BC4_SNORM:
+        case DXGI_FORMAT_BC5_UNORM:
+        case DXGI_FORMAT_BC5_SNORM:
+        case DXGI_FORMAT_BC6H_UF16:
+        case DXGI_FORMAT_BC6H_SF16:
+        case DXGI_FORMAT_BC7_UNORM: {
+            return true;
+        }
+        break;
+
+        default: {
+            return false;
+        }
+        break;
+        }
+    }
+
+    uint32_t Texture::getBytesPerBlock(const DXGI_FORMAT format)
+    {
+        switch (getNonSRGBFormat(format))
+        {
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC4_UNORM:
+        case DXGI_FORMAT_BC4_SNORM: {
+            return 8u;
+        }
+        break;
+
+        case DXGI_FORMAT_BC2_UNORM:
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC5_UNORM:
+        case DXGI_FORMAT_BC5_SNORM:
+        case DXGI_FORMAT_BC6H_UF16:
+        case DXGI_FORMAT_BC6H_SF16:
+        case DXGI_FORMAT_BC7_UNORM:
+        case DXGI_FORMAT_R32G32B32A32_FLOAT: {
+            return 16u;
+        }
+        break;
+
+        case DXGI_FORMAT_R16G16B16A16_FLOAT: {
+            return 8u;
+        }
+        break;
+
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_UNORM:
+        case DXGI_FORMAT_R32_FLOAT: {
+            return 4u;
+        }
+        break;
+
+        case DXGI_FORMAT_R8G8_UNORM: {
+            return 2u;
+        }
+        break;
+
+        case DXGI_FORMAT_R8_UNORM: {
+            return 1u;
+        }
+        break;
+
+        default: {
+            fatalError(std::format("Unsupported texture format : {}.", static_cast<uint32_t>(format)));
+        }
+        break;
+        }
+
+        return 0u;
+    }
 } // namespace helios::gfx
\ No newline at end of file
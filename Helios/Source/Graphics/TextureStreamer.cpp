@@ -0,0 +1,340 @@
+#include "Graphics/TextureStreamer.hpp"
+
+#include "Graphics/GraphicsDevice.hpp"
+
+namespace helios::gfx
+{
+    namespace
+    {
+        // Mips are only dropped once the requested mip is this many levels above the resident mip, so that textures
+        // requested at a mip boundary are not streamed in and out every few frames.
+        constexpr float MIP_HYSTERESIS = 0.5f;
+
+        constexpr float NOT_REQUESTED = std::numeric_limits<float>::max();
+    } // namespace
+
+    TextureStreamer::TextureStreamer(const GraphicsDevice* const graphicsDevice) : m_graphicsDevice(*graphicsDevice)
+    {
+    }
+
+    void TextureStreamer::registerTexture(const TextureHandle textureHandle, const std::wstring_view containerPath,
+                                          const DDSTextureDesc& textureDesc, const std::wstring_view name)
+    {
+        const std::vector<SubresourceLayout> subresourceLayouts = DDSFile::getSubresourceLayouts(
+            textureDesc.format, textureDesc.width, textureDesc.height, textureDesc.mipLevels);
+
+        std::vector<uint64_t> mipChainSizes(subresourceLayouts.size() + 1u, 0u);
+        for (size_t mip = subresourceLayouts.size(); mip > 0u; --mip)
+        {
+            mipChainSizes[mip - 1u] = mipChainSizes[mip] + subresourceLayouts[mip - 1u].getSizeInBytes();
+        }
+
+        const uint32_t tailMip = getTailMip(textureDesc);
+
+        StreamedTexture streamedTexture = {
+            .textureHandle = textureHandle,
+            .containerPath = std::wstring(containerPath),
+            .name = std::wstring(name),
+            .textureDesc = textureDesc,
+            .tailMip = tailMip,
+            .mipChainSizes = std::move(mipChainSizes),
+            .residentMip = tailMip,
+            .desiredMip = tailMip,
+            .srvIndices = {m_graphicsDevice.getTexturePool()->get(textureHandle)->srvIndex, INVALID_INDEX_U32},
+        };
+
+        const std::scoped_lock lock(m_mutex);
+
+        streamedTexture.lastResidencyChangeFrame = m_frame;
+        m_residentBytes += streamedTexture.mipChainSizes[tailMip];
+
+        // The texture may be in the pool slot of a texture that has been destroyed, but not yet removed.
+        if (const auto it = m_streamedTextureIndices.find(textureHandle.getIndex());
+            it != m_streamedTextureIndices.end())
+        {
+            StreamedTexture& destroyedTexture = m_streamedTextures[it->second];
+            m_residentBytes -= destroyedTexture.mipChainSizes[destroyedTexture.residentMip];
+            releaseInactiveSrv(destroyedTexture);
+
+            destroyedTexture = std::move(streamedTexture);
+
+            return;
+        }
+
+        m_streamedTextureIndices[textureHandle.getIndex()] = m_streamedTextures.size();
+        m_streamedTextures.emplace_back(std::move(streamedTexture));
+    }
+
+    uint32_t TextureStreamer::getTailMip(const DDSTextureDesc& textureDesc)
+    {
+        uint32_t tailMip{0u};
+        while (tailMip + 1u < textureDesc.mipLevels &&
+               std::max(textureDesc.width >> tailMip, textureDesc.height >> tailMip) > TAIL_MIP_DIMENSION)
+        {
+            ++tailMip;
+        }
+
+        while (tailMip > 0u && !isValidResidentMip(textureDesc, tailMip))
+        {
+            --tailMip;
+        }
+
+        return tailMip;
+    }
+
+    void TextureStreamer::requestMip(const TextureHandle textureHandle, const float textureCoordsPerPixel)
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        const auto it = m_streamedTextureIndices.find(textureHandle.getIndex());
+        if (it == m_streamedTextureIndices.end() || m_streamedTextures[it->second].textureHandle != textureHandle)
+        {
+            return;
+        }
+
+        StreamedTexture& streamedTexture = m_streamedTextures[it->second];
+
+        const float texelsPerPixel =
+            textureCoordsPerPixel *
+            static_cast<float>(std::max(streamedTexture.textureDesc.width, streamedTexture.textureDesc.height));
+
+        streamedTexture.requestedMip = std::min(streamedTexture.requestedMip, std::log2(texelsPerPixel));
+    }
+
+    void TextureStreamer::update()
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        ++m_frame;
+
+        TexturePool& texturePool = *m_graphicsDevice.getTexturePool();
+
+        // Remove the textures that have been destroyed (their allocation and current SRV have been released along with
+        // them).
+        const size_t streamedTextureCount = m_streamedTextures.size();
+        std::erase_if(m_streamedTextures, [&](const StreamedTexture& streamedTexture) {
+            if (texturePool.isValid(streamedTexture.textureHandle))
+            {
+                return false;
+            }
+
+            m_residentBytes -= streamedTexture.mipChainSizes[streamedTexture.residentMip];
+            releaseInactiveSrv(streamedTexture);
+            return true;
+        });
+
+        if (m_streamedTextures.size() != streamedTextureCount)
+        {
+            m_streamedTextureIndices.clear();
+            for (const size_t index : std::views::iota(0u, m_streamedTextures.size()))
+            {
+                m_streamedTextureIndices[m_streamedTextures[index].textureHandle.getIndex()] = index;
+            }
+        }
+
+        const uint64_t budget = computeDesiredMips();
+
+        // Textures are only changed once no frame in flight uses the SRV that is going to be written to.
+        std::vector<size_t> evictions{};
+        std::vector<size_t> streamIns{};
+
+        for (const size_t index : std::views::iota(0u, m_streamedTextures.size()))
+        {
+            const StreamedTexture& streamedTexture = m_streamedTextures[index];
+            if (streamedTexture.lastResidencyChangeFrame + GraphicsDevice::FRAMES_IN_FLIGHT > m_frame)
+            {
+                continue;
+            }
+
+            if (streamedTexture.desiredMip > streamedTexture.residentMip)
+            {
+                evictions.emplace_back(index);
+            }
+            else if (streamedTexture.desiredMip < streamedTexture.residentMip)
+            {
+                streamIns.emplace_back(index);
+            }
+        }
+
+        // The textures that are the furthest from their desired mip are streamed in first.
+        std::ranges::sort(streamIns, [&](const size_t a, const size_t b) {
+            return m_streamedTextures[a].residentMip - m_streamedTextures[a].desiredMip >
+                   m_streamedTextures[b].residentMip - m_streamedTextures[b].desiredMip;
+        });
+
+        // Evictions are done first, so that the memory they free can be used by the textures that are streamed in.
+        uint32_t residencyChanges{0u};
+
+        for (const std::span<const size_t> indices :
+             {std::span<const size_t>(evictions), std::span<const size_t>(streamIns)})
+        {
+            for (const size_t index : indices)
+            {
+                if (residencyChanges >= m_settings.maxResidencyChangesPerFrame)
+                {
+                    return;
+                }
+
+                StreamedTexture& streamedTexture = m_streamedTextures[index];
+
+                const uint64_t residentBytes = m_residentBytes -
+                                               streamedTexture.mipChainSizes[streamedTexture.residentMip] +
+                                               streamedTexture.mipChainSizes[streamedTexture.desiredMip];
+                if (streamedTexture.desiredMip < streamedTexture.residentMip && residentBytes > budget)
+                {
+                    continue;
+                }
+
+                // The reference keeps the texture alive while it is updated.
+                if (texturePool.tryAddReference(streamedTexture.textureHandle))
+                {
+                    setResidentMip(streamedTexture, *texturePool.get(streamedTexture.textureHandle),
+                                   streamedTexture.desiredMip);
+                    m_graphicsDevice.releaseTexture(streamedTexture.textureHandle);
+
+                    ++residencyChanges;
+                }
+            }
+        }
+    }
+
+    bool TextureStreamer::isValidResidentMip(const DDSTextureDesc& textureDesc, const uint32_t mip)
+    {
+        if (!Texture::isBlockCompressed(textureDesc.format))
+        {
+            return true;
+        }
+
+        const uint32_t width = std::max(textureDesc.width >> mip, 1u);
+        const uint32_t height = std::max(textureDesc.height >> mip, 1u);
+
+        return width % 4u == 0u && height % 4u == 0u;
+    }
+
+    uint64_t TextureStreamer::computeDesiredMips()
+    {
+        uint64_t desiredBytes{};
+
+        for (StreamedTexture& streamedTexture : m_streamedTextures)
+        {
+            uint32_t desiredMip = streamedTexture.tailMip;
+
+            if (streamedTexture.requestedMip != NOT_REQUESTED)
+            {
+                const auto toMip = [&](const float mip) {
+                    return static_cast<uint32_t>(
+                        std::clamp(std::floor(mip), 0.0f, static_cast<float>(streamedTexture.tailMip)));
+                };
+
+                const float requestedMip = streamedTexture.requestedMip + m_settings.mipBias;
+
+                desiredMip = toMip(requestedMip);
+                if (desiredMip > streamedTexture.residentMip)
+                {
+                    desiredMip = std::max(streamedTexture.residentMip, toMip(requestedMip - MIP_HYSTERESIS));
+                }
+
+                while (desiredMip > 0u && !isValidResidentMip(streamedTexture.textureDesc, desiredMip))
+                {
+                    --desiredMip;
+                }
+            }
+
+            streamedTexture.requestedMip = NOT_REQUESTED;
+            streamedTexture.desiredMip = desiredMip;
+
+            desiredBytes += streamedTexture.mipChainSizes[desiredMip];
+        }
+
+        // Video memory used by everything other than the streamed textures is not available to them.
+        const VideoMemoryBudget videoMemoryBudget = m_graphicsDevice.getVideoMemoryBudget();
+        const uint64_t otherUsageBytes =
+            videoMemoryBudget.usageBytes - std::min(videoMemoryBudget.usageBytes, m_residentBytes);
+
+        const uint64_t budget = std::min(m_settings.budgetBytes, videoMemoryBudget.budgetBytes > otherUsageBytes
+                                                                     ? videoMemoryBudget.budgetBytes - otherUsageBytes
+                                                                     : 0u);
+
+        // Drop the most detailed desired mip of the largest texture until the desired mips fit the budget. The tail
+        // mips are always resident.
+        const auto desiredSizeLess = [&](const size_t a, const size_t b) {
+            const StreamedTexture& textureA = m_streamedTextures[a];
+            const StreamedTexture& textureB = m_streamedTextures[b];
+
+            return textureA.mipChainSizes[textureA.desiredMip] < textureB.mipChainSizes[textureB.desiredMip];
+        };
+
+        std::priority_queue<size_t, std::vector<size_t>, decltype(desiredSizeLess)> largestTextures(desiredSizeLess);
+        for (const size_t index : std::views::iota(0u, m_streamedTextures.size()))
+        {
+            if (m_streamedTextures[index].desiredMip < m_streamedTextures[index].tailMip)
+            {
+                largestTextures.push(index);
+            }
+        }
+
+        while (desiredBytes > budget && !largestTextures.empty())
+        {
+            const size_t index = largestTextures.top();
+            largestTextures.pop();
+
+            StreamedTexture& streamedTexture = m_streamedTextures[index];
+
+            uint32_t desiredMip = streamedTexture.desiredMip + 1u;
+            while (desiredMip < streamedTexture.tailMip && !isValidResidentMip(streamedTexture.textureDesc, desiredMip))
+            {
+                ++desiredMip;
+            }
+
+            desiredBytes -= streamedTexture.mipChainSizes[streamedTexture.desiredMip] -
+                            streamedTexture.mipChainSizes[desiredMip];
+            streamedTexture.desiredMip = desiredMip;
+
+            if (desiredMip < streamedTexture.tailMip)
+            {
+                largestTextures.push(index);
+            }
+        }
+
+        return budget;
+    }
+
+    void TextureStreamer::setResidentMip(StreamedTexture& streamedTexture, Texture& texture, const uint32_t mip)
+    {
+        const uint32_t nextSrvSlot = streamedTexture.srvSlot ^ 1u;
+
+        Texture residentTexture = m_graphicsDevice.createTexture(TextureCreationDesc{
+            .usage = TextureUsage::TextureFromContainer,
+            .name = streamedTexture.name,
+            .path = streamedTexture.containerPath,
+            .mostDetailedMip = mip,
+            .srvIndex = streamedTexture.srvIndices[nextSrvSlot],
+        });
+
+        // Frames in flight may still sample the previous allocation (through the other SRV).
+        m_graphicsDevice.deferRelease(std::move(texture.allocation));
+
+        texture.allocation = std::move(residentTexture.allocation);
+        texture.width = residentTexture.width;
+        texture.height = residentTexture.height;
+        texture.srvIndex = residentTexture.srvIndex;
+
+        m_residentBytes = m_residentBytes - streamedTexture.mipChainSizes[streamedTexture.residentMip] +
+                          streamedTexture.mipChainSizes[mip];
+
+        streamedTexture.srvIndices[nextSrvSlot] = residentTexture.srvIndex;
+        streamedTexture.srvSlot = nextSrvSlot;
+        streamedTexture.residentMip = mip;
+        streamedTexture.lastResidencyChangeFrame = m_frame;
+
+        ++m_residencyChangeCount;
+    }
+
+    void TextureStreamer::releaseInactiveSrv(const StreamedTexture& streamedTexture) const
+    {
+        m_graphicsDevice.deferRelease(DescriptorRange{
+            .descriptorHeap = m_graphicsDevice.getCbvSrvUavDescriptorHeap(),
+            .index = streamedTexture.srvIndices[streamedTexture.srvSlot ^ 1u],
+        });
+    }
+} // namespace helios::gfx
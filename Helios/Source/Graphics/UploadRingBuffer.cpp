@@ -0,0 +1,282 @@
+#include "Graphics/UploadRingBuffer.hpp"
+
+#include "Graphics/CommandQueue.hpp"
+#include "Graphics/GraphicsDevice.hpp"
+#include "Graphics/MemoryAllocator.hpp"
+
+namespace helios::gfx
+{
+    namespace
+    {
+        constexpr uint64_t alignUp(const uint64_t value, const uint64_t alignment)
+        {
+            return (value + alignment - 1u) & ~(alignment - 1u);
+        }
+    } // namespace
+
+    UploadRingBuffer::UploadRingBuffer(GraphicsDevice* const graphicsDevice, MemoryAllocator* const memoryAllocator,
+                                       CommandQueue* const copyCommandQueue)
+        : m_graphicsDevice(*graphicsDevice), m_memoryAllocator(*memoryAllocator), m_copyCommandQueue(*copyCommandQueue)
+    {
+        m_ringAllocation = m_memoryAllocator.createBufferResourceAllocation(
+            BufferCreationDesc{
+                .usage = BufferUsage::UploadBuffer,
+                .name = L"Upload Ring Buffer",
+            },
+            ResourceCreationDesc::createBufferResourceCreationDesc(CAPACITY));
+
+        m_ringCpuAddress = static_cast<std::byte*>(m_ringAllocation.mappedPointer.value());
+    }
+
+    UploadRingBuffer::~UploadRingBuffer()
+    {
+        // The ring (and the dedicated upload buffers) can only be released once the copy queue no longer reads them.
+        const std::scoped_lock lock(m_mutex);
+
+        m_copyCommandQueue.waitForFenceValue(submitBatch());
+    }
+
+    UploadTicket UploadRingBuffer::uploadBuffer(ID3D12Resource* const destinationResource, const void* data,
+                                                const uint64_t sizeInBytes)
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        const UploadRegion uploadRegion = allocate(sizeInBytes, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        std::memcpy(uploadRegion.cpuAddress, data, sizeInBytes);
+
+        getRecordingCopyContext()->getCommandList()->CopyBufferRegion(destinationResource, 0u, uploadRegion.resource,
+                                                                      uploadRegion.offset, sizeInBytes);
+
+        return onUploadRecorded(sizeInBytes);
+    }
+
+    UploadTicket UploadRingBuffer::uploadTexture(ID3D12Resource* const destinationResource,
+                                                 const std::span<const D3D12_SUBRESOURCE_DATA> subresourceData)
+    {
+        const uint32_t subresourceCount = static_cast<uint32_t>(subresourceData.size());
+        const D3D12_RESOURCE_DESC resourceDesc = destinationResource->GetDesc();
+
+        std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints(subresourceCount);
+        std::vector<UINT> rowCounts(subresourceCount);
+        std::vector<UINT64> rowSizes(subresourceCount);
+        UINT64 sizeInBytes{};
+
+        m_graphicsDevice.getDevice()->GetCopyableFootprints(&resourceDesc, 0u, subresourceCount, 0u,
+                                                            footprints.data(), rowCounts.data(), rowSizes.data(),
+                                                            &sizeInBytes);
+
+        const std::scoped_lock lock(m_mutex);
+
+        const UploadRegion uploadRegion = allocate(sizeInBytes, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        CopyContext* const copyContext = getRecordingCopyContext();
+
+        for (const uint32_t i : std::views::iota(0u, subresourceCount))
+        {
+            const D3D12_MEMCPY_DEST memcpyDest = {
+                .pData = uploadRegion.cpuAddress + footprints[i].Offset,
+                .RowPitch = footprints[i].Footprint.RowPitch,
+                .SlicePitch = static_cast<SIZE_T>(footprints[i].Footprint.RowPitch) * rowCounts[i],
+            };
+
+            MemcpySubresource(&memcpyDest, &subresourceData[i], static_cast<SIZE_T>(rowSizes[i]), rowCounts[i],
+                              footprints[i].Footprint.Depth);
+
+            footprints[i].Offset += uploadRegion.offset;
+
+            const CD3DX12_TEXTURE_COPY_LOCATION destinationLocation(destinationResource, i);
+            const CD3DX12_TEXTURE_COPY_LOCATION sourceLocation(uploadRegion.resource, footprints[i]);
+
+            copyContext->getCommandList()->CopyTextureRegion(&destinationLocation, 0u, 0u, 0u, &sourceLocation,
+                                                             nullptr);
+        }
+
+        return onUploadRecorded(sizeInBytes);
+    }
+
+    uint64_t UploadRingBuffer::submit()
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        return submitBatch();
+    }
+
+    UploadTicket UploadRingBuffer::getLatestUploadTicket()
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        return UploadTicket{
+            .batchIndex = m_copyContext ? m_submittedBatchCount + 1u : m_submittedBatchCount,
+        };
+    }
+
+    bool UploadRingBuffer::isUploadComplete(const UploadTicket& uploadTicket)
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        retireCompletedBatches();
+
+        return uploadTicket.batchIndex <= m_retiredBatchCount;
+    }
+
+    void UploadRingBuffer::waitForUpload(const UploadTicket& uploadTicket)
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        if (uploadTicket.batchIndex > m_submittedBatchCount)
+        {
+            submitBatch();
+        }
+
+        // Batches are executed in order, so the batch of the ticket has completed once the batch index is retired.
+        while (uploadTicket.batchIndex > m_retiredBatchCount)
+        {
+            m_copyCommandQueue.waitForFenceValue(m_batches.front().fenceValue);
+            retireCompletedBatches();
+        }
+    }
+
+    UploadRingBuffer::UploadRegion UploadRingBuffer::allocate(const uint64_t sizeInBytes, const uint64_t alignment)
+    {
+        if (sizeInBytes > CAPACITY)
+        {
+            Allocation dedicatedAllocation = m_memoryAllocator.createBufferResourceAllocation(
+                BufferCreationDesc{
+                    .usage = BufferUsage::UploadBuffer,
+                    .name = L"Dedicated Upload Buffer",
+                },
+                ResourceCreationDesc::createBufferResourceCreationDesc(sizeInBytes));
+
+            const UploadRegion uploadRegion = {
+                .cpuAddress = static_cast<std::byte*>(dedicatedAllocation.mappedPointer.value()),
+                .resource = dedicatedAllocation.resource.Get(),
+                .offset = 0u,
+            };
+
+            m_pendingDedicatedAllocations.emplace_back(std::move(dedicatedAllocation));
+
+            return uploadRegion;
+        }
+
+        while (true)
+        {
+            // The bytes from the head to the end of the ring are skipped if the region does not fit before the end.
+            uint64_t offset = alignUp(m_head, alignment);
+            uint64_t paddedSizeInBytes = offset - m_head + sizeInBytes;
+
+            if (offset + sizeInBytes > CAPACITY)
+            {
+                offset = 0u;
+                paddedSizeInBytes = CAPACITY - m_head + sizeInBytes;
+            }
+
+            if (m_usedBytes + paddedSizeInBytes <= CAPACITY)
+            {
+                m_head = offset + sizeInBytes;
+                m_usedBytes += paddedSizeInBytes;
+                m_pendingRingBytes += paddedSizeInBytes;
+
+                return UploadRegion{
+                    .cpuAddress = m_ringCpuAddress + offset,
+                    .resource = m_ringAllocation.resource.Get(),
+                    .offset = offset,
+                };
+            }
+
+            // The ring is empty, but the region does not fit between the head and the end of the ring.
+            if (m_usedBytes == 0u)
+            {
+                m_head = 0u;
+                continue;
+            }
+
+            // Wait for the oldest batch to free its bytes (the pending copies are submitted first if they are the only
+            // ones using the ring).
+            if (m_batches.empty())
+            {
+                submitBatch();
+            }
+
+            m_copyCommandQueue.waitForFenceValue(m_batches.front().fenceValue);
+            retireCompletedBatches();
+        }
+    }
+
+    CopyContext* UploadRingBuffer::getRecordingCopyContext()
+    {
+        if (!m_copyContext)
+        {
+            retireCompletedBatches();
+
+            if (!m_freeCopyContexts.empty())
+            {
+                m_copyContext = std::move(m_freeCopyContexts.back());
+                m_freeCopyContexts.pop_back();
+            }
+            else
+            {
+                m_copyContext = std::make_unique<CopyContext>(&m_graphicsDevice);
+            }
+
+            m_copyContext->reset();
+        }
+
+        return m_copyContext.get();
+    }
+
+    uint64_t UploadRingBuffer::submitBatch()
+    {
+        if (!m_copyContext)
+        {
+            return m_lastSubmittedFenceValue;
+        }
+
+        const std::array<const Context* const, 1u> contexts = {
+            m_copyContext.get(),
+        };
+
+        m_copyCommandQueue.executeContext(contexts);
+        m_lastSubmittedFenceValue = m_copyCommandQueue.signal();
+
+        m_batches.emplace_back(Batch{
+            .batchIndex = ++m_submittedBatchCount,
+            .copyContext = std::move(m_copyContext),
+            .fenceValue = m_lastSubmittedFenceValue,
+            .sizeInBytes = m_pendingRingBytes,
+            .dedicatedAllocations = std::move(m_pendingDedicatedAllocations),
+        });
+
+        m_pendingRingBytes = 0u;
+        m_pendingUploadBytes = 0u;
+        m_pendingDedicatedAllocations.clear();
+
+        return m_lastSubmittedFenceValue;
+    }
+
+    void UploadRingBuffer::retireCompletedBatches()
+    {
+        while (!m_batches.empty() && m_copyCommandQueue.isFenceComplete(m_batches.front().fenceValue))
+        {
+            m_usedBytes -= m_batches.front().sizeInBytes;
+            m_freeCopyContexts.emplace_back(std::move(m_batches.front().copyContext));
+            m_retiredBatchCount = m_batches.front().batchIndex;
+
+            m_batches.pop_front();
+        }
+    }
+
+    UploadTicket UploadRingBuffer::onUploadRecorded(const uint64_t sizeInBytes)
+    {
+        const UploadTicket uploadTicket = {
+            .batchIndex = m_submittedBatchCount + 1u,
+        };
+
+        m_pendingUploadBytes += sizeInBytes;
+
+        if (m_pendingUploadBytes >= SUBMISSION_THRESHOLD)
+        {
+            submitBatch();
+        }
+
+        return uploadTicket;
+    }
+} // namespace helios::gfx
@@ -42,17 +42,9 @@ namespace helios::rendering
             .name = L"Bloom UpSample Texture",
         });
 
-        // Create Bloom buffer.
-        m_bloomBuffer = graphicsDevice->createBuffer<interlop::BloomBuffer>(gfx::BufferCreationDesc{
-            .usage = gfx::BufferUsage::ConstantBuffer,
-            .name = L"Bloom Buffer",
-        });
-
         m_bloomBufferData.threshHold = 1.0f;
         m_bloomBufferData.radius = 1.0f;
 
-        m_bloomBuffer.update(&m_bloomBufferData);
-
         // Create Bloom extraction texture and pipeline state.
         m_extractionTexture = graphicsDevice->createTexture(gfx::TextureCreationDesc{
             .usage = gfx::TextureUsage::UAVTexture,
@@ -73,7 +65,7 @@ namespace helios::rendering
     void BloomPass::render(gfx::GraphicsContext* const graphicsContext, gfx::Texture& shadingTexture, gfx::Texture& lightPassTexture, const uint32_t width,
                            const uint32_t height)
     {
-        m_bloomBuffer.update(&m_bloomBufferData);
+        m_bloomBuffer = graphicsContext->allocateFrameConstants(m_bloomBufferData);
 
         {
             graphicsContext->setComputePipelineState(m_extractionPipelineState);
@@ -31,19 +31,12 @@ namespace helios::rendering
             .name = L"PCF Shadow Mapping Pass Depth Texture",
         });
 
-        m_shadowBuffer = graphicsDevice->createBuffer<interlop::SceneBuffer>(gfx::BufferCreationDesc{
-            .usage = gfx::BufferUsage::ConstantBuffer,
-            .name = L"Shadow Buffer",
-        });
-
         m_shadowBufferData = {
             .backOffDistance = 200.0f,
             .extents = 180.0f,
             .nearPlane = 1.0f,
             .farPlane = 370.0f,
         };
-
-        m_shadowBuffer.update(&m_shadowBufferData);
     }
 
     void PCFShadowMappingPass::render(scene::Scene& scene, gfx::GraphicsContext* const graphicsContext)
@@ -62,7 +55,7 @@ namespace helios::rendering
             m_shadowBufferData.extents, m_shadowBufferData.nearPlane, m_shadowBufferData.farPlane);
 
         m_shadowBufferData.lightViewProjectionMatrix = lightViewMatrix * lightProjectionMatrix;
-        m_shadowBuffer.update(&m_shadowBufferData);
+        m_shadowBuffer = graphicsContext->allocateFrameConstants(m_shadowBufferData);
 
         graphicsContext->setViewport(D3D12_VIEWPORT{
             .TopLeftX = 0.0f,
@@ -92,7 +85,8 @@ namespace helios::rendering
             .shadowBufferIndex = m_shadowBuffer.cbvIndex,
         };
 
-        scene.renderModels(graphicsContext, shadowRenderResources);
+        scene.renderModels(graphicsContext, shadowRenderResources,
+                           static_cast<float>(SHADOW_MAP_DIMENSIONS) / (2.0f * m_shadowBufferData.extents));
 
         // This transition is not required till the shading passes, hence moved to the SandBox's render loop.
         // graphicsContext->addResourceBarrier(m_shadowDepthBuffer.allocation.resource.Get(),
@@ -42,11 +42,6 @@ namespace helios::rendering
             math::XMStoreFloat4(&m_ssaoBufferData.sampleVectors[i], samplePosition);
         }
 
-        m_ssaoBuffer = graphicsDevice->createBuffer<interlop::SSAOBuffer>(gfx::BufferCreationDesc{
-            .usage = gfx::BufferUsage::ConstantBuffer,
-            .name = L"SSAO Buffer",
-        });
-
         m_ssaoBufferData.bias = 0.025f;
         m_ssaoBufferData.radius = 1.625f;
         m_ssaoBufferData.power = 1.0f;
@@ -101,8 +96,6 @@ namespace helios::rendering
             .csShaderPath = L"Shaders/PostProcessing/BoxBlur.hlsl",
             .pipelineName = L"Box Blur Pipeline State",
         });
-
-        m_ssaoBuffer.update(&m_ssaoBufferData);
     }
 
     void SSAOPass::render(gfx::GraphicsContext* const graphicsContext, interlop::SSAORenderResources& renderResources,
@@ -111,7 +104,7 @@ namespace helios::rendering
         m_ssaoBufferData.screenDimensions = {static_cast<float>(width), static_cast<float>(height)};
         m_ssaoBufferData.noiseScaleDimensions = {width / static_cast<float>(interlop::NOISE_TEXTURE_DIMENSIONS), height / static_cast<float>(interlop::NOISE_TEXTURE_DIMENSIONS)};
 
-        m_ssaoBuffer.update(&m_ssaoBufferData);
+        m_ssaoBuffer = graphicsContext->allocateFrameConstants(m_ssaoBufferData);
 
         // Setup the SSAO texture.
         {
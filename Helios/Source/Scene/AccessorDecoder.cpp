@@ -0,0 +1,635 @@
+#include "Scene/AccessorDecoder.hpp"
+
+#include <immintrin.h>
+#include <intrin.h>
+
+namespace helios::scene
+{
+    namespace
+    {
+        // The AVX2 paths are compiled unconditionally, but are only used if the CPU (and OS) support them.
+        bool isAVX2Supported()
+        {
+            static const bool isSupported = []() {
+                std::array<int, 4> cpuInfo{};
+
+                __cpuid(cpuInfo.data(), 0);
+                if (cpuInfo[0] < 7)
+                {
+                    return false;
+                }
+
+                // OSXSAVE (bit 27) and AVX (bit 28), and the OS must save the YMM registers on context switches.
+                __cpuid(cpuInfo.data(), 1);
+                if ((cpuInfo[2] & (1 << 27)) == 0 || (cpuInfo[2] & (1 << 28)) == 0 || (_xgetbv(0) & 0x6u) != 0x6u)
+                {
+                    return false;
+                }
+
+                __cpuidex(cpuInfo.data(), 7, 0);
+                return (cpuInfo[1] & (1 << 5)) != 0;
+            }();
+
+            return isSupported;
+        }
+
+        template <typename T> T readValue(const std::byte* data)
+        {
+            T value{};
+            std::memcpy(&value, data, sizeof(T));
+
+            return value;
+        }
+
+        // Scale applied to normalized integers, as per the glTF 2.0 specification.
+        float getNormalizationScale(const AccessorComponentType componentType)
+        {
+            switch (componentType)
+            {
+            case AccessorComponentType::Int8: {
+                return 1.0f / 127.0f;
+            }
+            break;
+
+            case AccessorComponentType::UInt8: {
+                return 1.0f / 255.0f;
+            }
+            break;
+
+            case AccessorComponentType::Int16: {
+                return 1.0f / 32767.0f;
+            }
+            break;
+
+            case AccessorComponentType::UInt16: {
+                return 1.0f / 65535.0f;
+            }
+            break;
+
+            case AccessorComponentType::UInt32: {
+                return 1.0f / 4294967295.0f;
+            }
+            break;
+
+            default: {
+                return 1.0f;
+            }
+            break;
+            }
+        }
+
+        bool isSignedInteger(const AccessorComponentType componentType)
+        {
+            return componentType == AccessorComponentType::Int8 || componentType == AccessorComponentType::Int16;
+        }
+
+        float readComponent(const std::byte* data, const AccessorComponentType componentType, const float scale,
+                            const bool clampToMinusOne)
+        {
+            float value{};
+
+            switch (componentType)
+            {
+            case AccessorComponentType::Int8: {
+                value = static_cast<float>(readValue<int8_t>(data));
+            }
+            break;
+
+            case AccessorComponentType::UInt8: {
+                value = static_cast<float>(readValue<uint8_t>(data));
+            }
+            break;
+
+            case AccessorComponentType::Int16: {
+                value = static_cast<float>(readValue<int16_t>(data));
+            }
+            break;
+
+            case AccessorComponentType::UInt16: {
+                value = static_cast<float>(readValue<uint16_t>(data));
+            }
+            break;
+
+            case AccessorComponentType::UInt32: {
+                value = static_cast<float>(readValue<uint32_t>(data));
+            }
+            break;
+
+            case AccessorComponentType::Float: {
+                return readValue<float>(data);
+            }
+            break;
+            }
+
+            value *= scale;
+
+            return clampToMinusOne ? std::max(value, -1.0f) : value;
+        }
+
+        uint32_t readIndex(const std::byte* data, const AccessorComponentType componentType)
+        {
+            switch (componentType)
+            {
+            case AccessorComponentType::UInt8: {
+                return readValue<uint8_t>(data);
+            }
+            break;
+
+            case AccessorComponentType::UInt16: {
+                return readValue<uint16_t>(data);
+            }
+            break;
+
+            case AccessorComponentType::UInt32: {
+                return readValue<uint32_t>(data);
+            }
+            break;
+
+            default: {
+                fatalError("Index accessors must have a unsigned integer component type.");
+            }
+            break;
+            }
+
+            return 0u;
+        }
+
+        // Loads 4 (SSE2) / 8 (AVX2) integers and sign / zero extends them to 32 bits.
+        template <AccessorComponentType ComponentType> __m128i loadIntegersSSE2(const std::byte* data)
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            if constexpr (ComponentType == AccessorComponentType::Int8 || ComponentType == AccessorComponentType::UInt8)
+            {
+                const __m128i bytes = _mm_cvtsi32_si128(readValue<int32_t>(data));
+
+                if constexpr (ComponentType == AccessorComponentType::Int8)
+                {
+                    const __m128i words = _mm_unpacklo_epi8(bytes, bytes);
+                    return _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 24);
+                }
+                else
+                {
+                    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+                }
+            }
+            else
+            {
+                const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+
+                if constexpr (ComponentType == AccessorComponentType::Int16)
+                {
+                    return _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+                }
+                else
+                {
+                    return _mm_unpacklo_epi16(words, zero);
+                }
+            }
+        }
+
+        template <AccessorComponentType ComponentType> __m256i loadIntegersAVX2(const std::byte* data)
+        {
+            if constexpr (ComponentType == AccessorComponentType::Int8)
+            {
+                return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+            }
+            else if constexpr (ComponentType == AccessorComponentType::UInt8)
+            {
+                return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+            }
+            else if constexpr (ComponentType == AccessorComponentType::Int16)
+            {
+                return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            }
+            else
+            {
+                return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            }
+        }
+
+        // Converts tightly packed 8 / 16 bit integers to floats. As the stream is tightly packed, the components can be
+        // processed without caring about element boundaries.
+        template <AccessorComponentType ComponentType>
+        void convertPackedIntegers(const std::byte* data, const size_t count, const bool normalized, float* output)
+        {
+            constexpr size_t componentSize = ComponentType == AccessorComponentType::Int8 ||
+                                                     ComponentType == AccessorComponentType::UInt8
+                                                 ? 1u
+                                                 : 2u;
+
+            const float scale = normalized ? getNormalizationScale(ComponentType) : 1.0f;
+            const bool clampToMinusOne = normalized && isSignedInteger(ComponentType);
+
+            size_t i = 0u;
+
+            if (isAVX2Supported())
+            {
+                const __m256 scaleVector = _mm256_set1_ps(scale);
+                const __m256 minVector = _mm256_set1_ps(clampToMinusOne ? -1.0f : std::numeric_limits<float>::lowest());
+
+                for (; i + 8u <= count; i += 8u)
+                {
+                    const __m256 values =
+                        _mm256_cvtepi32_ps(loadIntegersAVX2<ComponentType>(data + i * componentSize));
+                    _mm256_storeu_ps(output + i, _mm256_max_ps(_mm256_mul_ps(values, scaleVector), minVector));
+                }
+            }
+            else
+            {
+                const __m128 scaleVector = _mm_set1_ps(scale);
+                const __m128 minVector = _mm_set1_ps(clampToMinusOne ? -1.0f : std::numeric_limits<float>::lowest());
+
+                for (; i + 4u <= count; i += 4u)
+                {
+                    const __m128 values = _mm_cvtepi32_ps(loadIntegersSSE2<ComponentType>(data + i * componentSize));
+                    _mm_storeu_ps(output + i, _mm_max_ps(_mm_mul_ps(values, scaleVector), minVector));
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                output[i] = readComponent(data + i * componentSize, ComponentType, scale, clampToMinusOne);
+            }
+        }
+
+        // Gathers float3's from a interleaved stream, 4 elements at a time.
+        void gatherFloat3(const std::byte* data, const size_t count, const size_t stride, float* output)
+        {
+            size_t i = 0u;
+
+            // Each load reads 4 bytes past the float3, so the SIMD loop stops before the last element of the stream.
+            for (; i + 4u < count; i += 4u)
+            {
+                const __m128 a = _mm_loadu_ps(reinterpret_cast<const float*>(data + (i + 0u) * stride));
+                const __m128 b = _mm_loadu_ps(reinterpret_cast<const float*>(data + (i + 1u) * stride));
+                const __m128 c = _mm_loadu_ps(reinterpret_cast<const float*>(data + (i + 2u) * stride));
+                const __m128 d = _mm_loadu_ps(reinterpret_cast<const float*>(data + (i + 3u) * stride));
+
+                // (x0 y0 z0 x1), (y1 z1 x2 y2), (z2 x3 y3 z3).
+                const __m128 az_bx = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 2, 2));
+                const __m128 cz_dx = _mm_shuffle_ps(c, d, _MM_SHUFFLE(0, 0, 2, 2));
+
+                _mm_storeu_ps(output + i * 3u + 0u, _mm_shuffle_ps(a, az_bx, _MM_SHUFFLE(2, 0, 1, 0)));
+                _mm_storeu_ps(output + i * 3u + 4u, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 1)));
+                _mm_storeu_ps(output + i * 3u + 8u, _mm_shuffle_ps(cz_dx, d, _MM_SHUFFLE(2, 1, 2, 0)));
+            }
+
+            for (; i < count; ++i)
+            {
+                std::memcpy(output + i * 3u, data + i * stride, sizeof(float) * 3u);
+            }
+        }
+
+        // Gathers float2's from a interleaved stream, 2 elements at a time.
+        void gatherFloat2(const std::byte* data, const size_t count, const size_t stride, float* output)
+        {
+            size_t i = 0u;
+
+            for (; i + 2u <= count; i += 2u)
+            {
+                const __m128 a = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data + (i + 0u) * stride)));
+                const __m128 b = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data + (i + 1u) * stride)));
+
+                _mm_storeu_ps(output + i * 2u, _mm_movelh_ps(a, b));
+            }
+
+            for (; i < count; ++i)
+            {
+                std::memcpy(output + i * 2u, data + i * stride, sizeof(float) * 2u);
+            }
+        }
+
+        void decodeFloatAccessorScalar(const AccessorDesc& accessor, const uint32_t stride, float* output,
+                                       const uint32_t outputComponentCount)
+        {
+            const uint32_t componentSize = getComponentSize(accessor.componentType);
+            const uint32_t copiedComponentCount = std::min(accessor.componentCount, outputComponentCount);
+
+            const float scale = accessor.normalized ? getNormalizationScale(accessor.componentType) : 1.0f;
+            const bool clampToMinusOne = accessor.normalized && isSignedInteger(accessor.componentType);
+
+            for (const size_t i : std::views::iota(0u, accessor.count))
+            {
+                const std::byte* element = accessor.data + i * stride;
+                float* outputElement = output + i * outputComponentCount;
+
+                for (const uint32_t component : std::views::iota(0u, copiedComponentCount))
+                {
+                    outputElement[component] =
+                        readComponent(element + component * componentSize, accessor.componentType, scale,
+                                      clampToMinusOne);
+                }
+
+                std::fill(outputElement + copiedComponentCount, outputElement + outputComponentCount, 0.0f);
+            }
+        }
+
+        void widenIndices8(std::span<const uint8_t> input, std::span<uint16_t> output)
+        {
+            size_t i = 0u;
+
+            if (isAVX2Supported())
+            {
+                for (; i + 16u <= input.size(); i += 16u)
+                {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output.data() + i), _mm256_cvtepu8_epi16(bytes));
+                }
+            }
+            else
+            {
+                const __m128i zero = _mm_setzero_si128();
+
+                for (; i + 16u <= input.size(); i += 16u)
+                {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i), _mm_unpacklo_epi8(bytes, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i + 8u),
+                                     _mm_unpackhi_epi8(bytes, zero));
+                }
+            }
+
+            for (; i < input.size(); ++i)
+            {
+                output[i] = input[i];
+            }
+        }
+    } // namespace
+
+    uint32_t getComponentSize(const AccessorComponentType componentType)
+    {
+        switch (componentType)
+        {
+        case AccessorComponentType::Int8:
+        case AccessorComponentType::UInt8: {
+            return 1u;
+        }
+        break;
+
+        case AccessorComponentType::Int16:
+        case AccessorComponentType::UInt16: {
+            return 2u;
+        }
+        break;
+
+        case AccessorComponentType::UInt32:
+        case AccessorComponentType::Float: {
+            return 4u;
+        }
+        break;
+        }
+
+        fatalError(std::format("Invalid accessor component type : {}", enumClassValue(componentType)));
+        return 0u;
+    }
+
+    void decodeFloatAccessor(const AccessorDesc& accessor, std::span<float> output,
+                             const uint32_t outputComponentCount)
+    {
+        if (output.size() < static_cast<size_t>(accessor.count) * outputComponentCount)
+        {
+            fatalError("Output span is too small to decode the accessor into.");
+        }
+
+        const uint32_t elementSize = getComponentSize(accessor.componentType) * accessor.componentCount;
+        const uint32_t stride = accessor.byteStride != 0u ? accessor.byteStride : elementSize;
+
+        const bool isFloat = accessor.componentType == AccessorComponentType::Float;
+        const bool isPacked = stride == elementSize;
+        const bool hasSameComponentCount = accessor.componentCount == outputComponentCount;
+
+        if (!accessor.data)
+        {
+            std::fill_n(output.begin(), static_cast<size_t>(accessor.count) * outputComponentCount, 0.0f);
+        }
+        else if (isFloat && isPacked && hasSameComponentCount)
+        {
+            std::memcpy(output.data(), accessor.data, static_cast<size_t>(accessor.count) * elementSize);
+        }
+        else if (isFloat && hasSameComponentCount && outputComponentCount == 3u)
+        {
+            gatherFloat3(accessor.data, accessor.count, stride, output.data());
+        }
+        else if (isFloat && hasSameComponentCount && outputComponentCount == 2u)
+        {
+            gatherFloat2(accessor.data, accessor.count, stride, output.data());
+        }
+        else if (isPacked && hasSameComponentCount && accessor.componentType != AccessorComponentType::UInt32)
+        {
+            const size_t componentCount = static_cast<size_t>(accessor.count) * accessor.componentCount;
+
+            switch (accessor.componentType)
+            {
+            case AccessorComponentType::Int8: {
+                convertPackedIntegers<AccessorComponentType::Int8>(accessor.data, componentCount,
+                                                                   accessor.normalized, output.data());
+            }
+            break;
+
+            case AccessorComponentType::UInt8: {
+                convertPackedIntegers<AccessorComponentType::UInt8>(accessor.data, componentCount,
+                                                                    accessor.normalized, output.data());
+            }
+            break;
+
+            case AccessorComponentType::Int16: {
+                convertPackedIntegers<AccessorComponentType::Int16>(accessor.data, componentCount,
+                                                                    accessor.normalized, output.data());
+            }
+            break;
+
+            case AccessorComponentType::UInt16: {
+                convertPackedIntegers<AccessorComponentType::UInt16>(accessor.data, componentCount,
+                                                                     accessor.normalized, output.data());
+            }
+            break;
+            }
+        }
+        else
+        {
+            decodeFloatAccessorScalar(accessor, stride, output.data(), outputComponentCount);
+        }
+
+        // Apply the sparse substitutions (the values are a regular, tightly packed accessor).
+        if (accessor.sparse.count > 0u)
+        {
+            const AccessorDesc sparseValuesAccessor = {
+                .data = accessor.sparse.values,
+                .count = accessor.sparse.count,
+                .componentCount = accessor.componentCount,
+                .componentType = accessor.componentType,
+                .normalized = accessor.normalized,
+            };
+
+            std::vector<float> sparseValues(static_cast<size_t>(accessor.sparse.count) * outputComponentCount);
+            decodeFloatAccessor(sparseValuesAccessor, sparseValues, outputComponentCount);
+
+            const uint32_t indexSize = getComponentSize(accessor.sparse.indexComponentType);
+
+            for (const size_t i : std::views::iota(0u, accessor.sparse.count))
+            {
+                const uint32_t index =
+                    readIndex(accessor.sparse.indices + i * indexSize, accessor.sparse.indexComponentType);
+                if (index >= accessor.count)
+                {
+                    fatalError("Sparse accessor index is out of range.");
+                }
+
+                std::copy_n(sparseValues.begin() + i * outputComponentCount, outputComponentCount,
+                            output.begin() + static_cast<size_t>(index) * outputComponentCount);
+            }
+        }
+    }
+
+    std::vector<math::XMFLOAT3> decodeFloat3Accessor(const AccessorDesc& accessor)
+    {
+        std::vector<math::XMFLOAT3> output(accessor.count);
+        decodeFloatAccessor(accessor, std::span(reinterpret_cast<float*>(output.data()), output.size() * 3u), 3u);
+
+        return output;
+    }
+
+    std::vector<math::XMFLOAT2> decodeFloat2Accessor(const AccessorDesc& accessor)
+    {
+        std::vector<math::XMFLOAT2> output(accessor.count);
+        decodeFloatAccessor(accessor, std::span(reinterpret_cast<float*>(output.data()), output.size() * 2u), 2u);
+
+        return output;
+    }
+
+    uint32_t decodeIndexAccessor(const AccessorDesc& accessor, const uint32_t vertexCount,
+                                 std::vector<std::byte>& indices)
+    {
+        const uint32_t componentSize = getComponentSize(accessor.componentType);
+        const uint32_t stride = accessor.byteStride != 0u ? accessor.byteStride : componentSize;
+
+        // 8 / 16 bit source indices always fit, 32 bit source indices only if the vertex count allows it.
+        const bool use16BitIndices =
+            accessor.componentType != AccessorComponentType::UInt32 || vertexCount <= 65536u;
+        const uint32_t indexStride = use16BitIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+
+        indices.resize(static_cast<size_t>(accessor.count) * indexStride);
+
+        const std::span<uint16_t> indices16(reinterpret_cast<uint16_t*>(indices.data()), accessor.count);
+        const std::span<uint32_t> indices32(reinterpret_cast<uint32_t*>(indices.data()), accessor.count);
+
+        const auto writeIndex = [&](const size_t i, const uint32_t index) {
+            if (use16BitIndices)
+            {
+                indices16[i] = static_cast<uint16_t>(index);
+            }
+            else
+            {
+                indices32[i] = index;
+            }
+        };
+
+        const bool isPacked = stride == componentSize && accessor.data && accessor.sparse.count == 0u;
+
+        if (isPacked && accessor.componentType == AccessorComponentType::UInt8)
+        {
+            widenIndices8(std::span(reinterpret_cast<const uint8_t*>(accessor.data), accessor.count), indices16);
+        }
+        else if (isPacked && (accessor.componentType == AccessorComponentType::UInt16 || !use16BitIndices))
+        {
+            std::memcpy(indices.data(), accessor.data, indices.size());
+        }
+        else if (isPacked)
+        {
+            narrowIndices(std::span(reinterpret_cast<const uint32_t*>(accessor.data), accessor.count), indices16);
+        }
+        else
+        {
+            for (const size_t i : std::views::iota(0u, accessor.count))
+            {
+                writeIndex(i, accessor.data ? readIndex(accessor.data + i * stride, accessor.componentType) : 0u);
+            }
+
+            const uint32_t sparseIndexSize =
+                accessor.sparse.count > 0u ? getComponentSize(accessor.sparse.indexComponentType) : 0u;
+
+            for (const size_t i : std::views::iota(0u, accessor.sparse.count))
+            {
+                const uint32_t index =
+                    readIndex(accessor.sparse.indices + i * sparseIndexSize, accessor.sparse.indexComponentType);
+                if (index >= accessor.count)
+                {
+                    fatalError("Sparse accessor index is out of range.");
+                }
+
+                writeIndex(index, readIndex(accessor.sparse.values + i * componentSize, accessor.componentType));
+            }
+        }
+
+        return indexStride;
+    }
+
+    void widenIndices(std::span<const uint16_t> input, std::span<uint32_t> output)
+    {
+        size_t i = 0u;
+
+        if (isAVX2Supported())
+        {
+            for (; i + 8u <= input.size(); i += 8u)
+            {
+                const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output.data() + i), _mm256_cvtepu16_epi32(words));
+            }
+        }
+        else
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 8u <= input.size(); i += 8u)
+            {
+                const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i), _mm_unpacklo_epi16(words, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i + 4u), _mm_unpackhi_epi16(words, zero));
+            }
+        }
+
+        for (; i < input.size(); ++i)
+        {
+            output[i] = input[i];
+        }
+    }
+
+    void narrowIndices(std::span<const uint32_t> input, std::span<uint16_t> output)
+    {
+        size_t i = 0u;
+
+        if (isAVX2Supported())
+        {
+            for (; i + 16u <= input.size(); i += 16u)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + i + 8u));
+
+                // packus operates per 128 bit lane, so the 64 bit blocks have to be reordered afterwards.
+                const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output.data() + i), packed);
+            }
+        }
+        else
+        {
+            // SSE2 only has a signed saturating pack, so bias the indices into the signed 16 bit range and back.
+            const __m128i bias32 = _mm_set1_epi32(32768);
+            const __m128i bias16 = _mm_set1_epi16(static_cast<int16_t>(-32768));
+
+            for (; i + 8u <= input.size(); i += 8u)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i + 4u));
+
+                const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i), _mm_add_epi16(packed, bias16));
+            }
+        }
+
+        for (; i < input.size(); ++i)
+        {
+            output[i] = static_cast<uint16_t>(input[i]);
+        }
+    }
+} // namespace helios::scene
@@ -9,18 +9,6 @@ namespace helios::scene
 {
     Lights::Lights(const gfx::GraphicsDevice* const graphicsDevice)
     {
-        // Create light related constant buffers.
-        m_lightsBuffer = graphicsDevice->createBuffer<interlop::LightBuffer>(gfx::BufferCreationDesc{
-            .usage = gfx::BufferUsage::ConstantBuffer,
-            .name = L"Light Constant Buffer",
-        });
-
-        m_lightsInstanceBuffer =
-            graphicsDevice->createBuffer<interlop::LightInstancedRenderingBuffer>(gfx::BufferCreationDesc{
-                .usage = gfx::BufferUsage::ConstantBuffer,
-                .name = L"Light Instance Constant Buffer",
-            });
-
         // Create the light model
         m_lightModel = std::make_unique<Model>(graphicsDevice, ModelCreationDesc{
                                                                    .modelPath = L"Assets/Models/Cube/glTF/Cube.gltf",
@@ -56,7 +44,7 @@ namespace helios::scene
         m_lightsBufferData.numberOfLights = 1u;
     }
 
-    void Lights::update(const math::XMMATRIX viewMatrix)
+    void Lights::update(const gfx::GraphicsDevice* const graphicsDevice, const math::XMMATRIX viewMatrix)
     {
         // Loop starts from 1, since the directional light will be at index 0.
         for (const uint32_t i : std::views::iota(1u, m_currentLightCount))
@@ -85,8 +73,8 @@ namespace helios::scene
 
         m_lightsBufferData.numberOfLights = m_currentLightCount;
 
-        m_lightsInstanceBuffer.update(&m_lightsInstancedBufferData);
-        m_lightsBuffer.update(&m_lightsBufferData);
+        m_lightsInstanceBuffer = graphicsDevice->allocateFrameConstants(m_lightsInstancedBufferData);
+        m_lightsBuffer = graphicsDevice->allocateFrameConstants(m_lightsBufferData);
     }
 
     void Lights::render(const gfx::GraphicsContext* const graphicsContext,
@@ -0,0 +1,135 @@
+#include "Scene/MaterialTable.hpp"
+
+#include "Graphics/GraphicsDevice.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        constexpr uint32_t INITIAL_CAPACITY = 64u;
+    } // namespace
+
+    MaterialTable::MaterialTable(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        m_buffers.resize(gfx::GraphicsDevice::FRAMES_IN_FLIGHT);
+        m_bufferUpdates.resize(gfx::GraphicsDevice::FRAMES_IN_FLIGHT);
+
+        growBuffers(graphicsDevice, INITIAL_CAPACITY);
+    }
+
+    uint32_t MaterialTable::addMaterial(const interlop::MaterialData& materialData)
+    {
+        const std::scoped_lock lock(m_addMutex);
+
+        m_addedMaterials.emplace_back(materialData);
+
+        return m_addedMaterialCount++;
+    }
+
+    void MaterialTable::setMaterial(const uint32_t materialIndex, const interlop::MaterialData& materialData)
+    {
+        m_materials[materialIndex] = materialData;
+        markPendingWrite(materialIndex);
+    }
+
+    void MaterialTable::addPendingMaterials()
+    {
+        const std::scoped_lock lock(m_addMutex);
+
+        const uint32_t previousMaterialCount = getMaterialCount();
+
+        m_materials.insert(m_materials.end(), m_addedMaterials.begin(), m_addedMaterials.end());
+        m_changeUpdates.resize(m_materials.size(), 0u);
+        m_isPendingWrite.resize(m_materials.size(), 0u);
+
+        for (const uint32_t materialIndex : std::views::iota(previousMaterialCount, getMaterialCount()))
+        {
+            markPendingWrite(materialIndex);
+        }
+
+        m_addedMaterials.clear();
+    }
+
+    void MaterialTable::update(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        addPendingMaterials();
+
+        if (getMaterialCount() > m_bufferCapacity)
+        {
+            growBuffers(graphicsDevice, getMaterialCount());
+        }
+
+        ++m_updateCount;
+
+        // The previous frame that used the table of the current frame index has completed, so it can be written to.
+        m_currentBufferIndex = graphicsDevice->getCurrentFrameIndex();
+
+        interlop::MaterialData* const bufferData =
+            static_cast<interlop::MaterialData*>(m_buffers[m_currentBufferIndex].allocation.mappedPointer.value());
+
+        for (const uint32_t materialIndex : m_pendingWriteIndices)
+        {
+            if (m_changeUpdates[materialIndex] > m_bufferUpdates[m_currentBufferIndex])
+            {
+                bufferData[materialIndex] = m_materials[materialIndex];
+            }
+        }
+
+        m_bufferUpdates[m_currentBufferIndex] = m_updateCount;
+
+        // Materials that have been written to all tables since they last changed no longer need to be written.
+        const uint64_t oldestBufferUpdate = std::ranges::min(m_bufferUpdates);
+
+        std::erase_if(m_pendingWriteIndices, [&](const uint32_t materialIndex) {
+            if (m_changeUpdates[materialIndex] > oldestBufferUpdate)
+            {
+                return false;
+            }
+
+            m_isPendingWrite[materialIndex] = 0u;
+            return true;
+        });
+    }
+
+    void MaterialTable::markPendingWrite(const uint32_t materialIndex)
+    {
+        m_changeUpdates[materialIndex] = m_updateCount + 1u;
+
+        if (!m_isPendingWrite[materialIndex])
+        {
+            m_isPendingWrite[materialIndex] = 1u;
+            m_pendingWriteIndices.emplace_back(materialIndex);
+        }
+    }
+
+    void MaterialTable::growBuffers(const gfx::GraphicsDevice* const graphicsDevice, const uint32_t materialCount)
+    {
+        m_bufferCapacity = std::max(m_bufferCapacity, INITIAL_CAPACITY);
+        while (m_bufferCapacity < materialCount)
+        {
+            m_bufferCapacity *= 2u;
+        }
+
+        const std::vector<interlop::MaterialData> initialData(m_bufferCapacity);
+
+        for (const uint32_t i : std::views::iota(0u, static_cast<uint32_t>(m_buffers.size())))
+        {
+            // Frames in flight may still read the previous table (and its SRV).
+            graphicsDevice->deferRelease(std::move(m_buffers[i]));
+
+            m_buffers[i] = graphicsDevice->createBuffer<interlop::MaterialData>(
+                gfx::BufferCreationDesc{
+                    .usage = gfx::BufferUsage::DynamicStructuredBuffer,
+                    .name = L"Material Table",
+                },
+                initialData);
+
+            m_bufferUpdates[i] = 0u;
+        }
+
+        for (const uint32_t materialIndex : std::views::iota(0u, getMaterialCount()))
+        {
+            markPendingWrite(materialIndex);
+        }
+    }
+} // namespace helios::scene
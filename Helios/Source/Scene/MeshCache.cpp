@@ -0,0 +1,603 @@
+#include "Scene/MeshCache.hpp"
+
+#include "Scene/AccessorDecoder.hpp"
+
+#include <fstream>
+
+namespace helios::scene
+{
+    namespace
+    {
+        enum class MeshStreamType : uint32_t
+        {
+            Positions,
+            Normals,
+            TextureCoords,
+            Indices,
+            Meshlets,
+            MeshletBounds,
+            MeshletVertices,
+            MeshletTriangles,
+            Lods,
+            LodIndices,
+            Count
+        };
+
+        static constexpr size_t MESH_STREAM_TYPE_COUNT = enumClassValue(MeshStreamType::Count);
+        static constexpr uint64_t STREAM_ALIGNMENT = 16u;
+
+        struct FileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t sourceHash;
+
+            uint32_t meshCount;
+            uint32_t materialCount;
+            uint32_t samplerCount;
+            uint32_t cookFlags;
+
+            uint64_t meshTableOffset;
+            uint64_t materialTableOffset;
+            uint64_t samplerTableOffset;
+            uint64_t stringDataOffset;
+            uint64_t stringDataSize;
+        };
+
+        struct FileStream
+        {
+            uint64_t offset;
+            uint32_t elementCount;
+            uint32_t elementStride;
+        };
+
+        struct FileMesh
+        {
+            std::array<FileStream, MESH_STREAM_TYPE_COUNT> streams;
+            math::XMFLOAT3 minBounds;
+            math::XMFLOAT3 maxBounds;
+            uint32_t materialIndex;
+            uint32_t padding;
+        };
+
+        // Strings are stored as (offset, length) pairs into the string data blob.
+        struct FileString
+        {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        struct FileMaterial
+        {
+            std::array<FileString, MATERIAL_TEXTURE_TYPE_COUNT> texturePaths;
+            std::array<int32_t, MATERIAL_TEXTURE_TYPE_COUNT> samplerIndices;
+            math::XMFLOAT4 baseColorFactor;
+        };
+
+        struct FileSampler
+        {
+            int32_t minFilter;
+            int32_t magFilter;
+            int32_t wrapS;
+            int32_t wrapT;
+        };
+
+        enum class CookFlags : uint32_t
+        {
+            None = 0u,
+            OptimizeMeshes = 1u << 0u,
+            BuildMeshlets = 1u << 1u,
+        };
+
+        // The LOD count is stored in the upper bits of the cook flags.
+        static constexpr uint32_t LOD_COUNT_COOK_FLAGS_SHIFT = 16u;
+
+        uint32_t getCookFlags(const MeshCookSettings& cookSettings)
+        {
+            uint32_t cookFlags = enumClassValue(CookFlags::None);
+            if (cookSettings.optimizeMeshes)
+            {
+                cookFlags |= enumClassValue(CookFlags::OptimizeMeshes);
+            }
+
+            if (cookSettings.buildMeshlets)
+            {
+                cookFlags |= enumClassValue(CookFlags::BuildMeshlets);
+            }
+
+            cookFlags |= cookSettings.lodCount << LOD_COUNT_COOK_FLAGS_SHIFT;
+
+            return cookFlags;
+        }
+
+        uint64_t alignUp(const uint64_t value, const uint64_t alignment)
+        {
+            return (value + alignment - 1u) & ~(alignment - 1u);
+        }
+
+        // FNV-1a, but consuming 8 bytes per step so that hashing large .glb files stays cheap compared to parsing them.
+        uint64_t hashBytes(const std::byte* data, const size_t size, uint64_t hash)
+        {
+            constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+
+            const size_t wordCount = size / sizeof(uint64_t);
+            for (const size_t i : std::views::iota(0ull, wordCount))
+            {
+                uint64_t word{};
+                std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+
+                hash = (hash ^ word) * FNV_PRIME;
+            }
+
+            for (const size_t i : std::views::iota(wordCount * sizeof(uint64_t), size))
+            {
+                hash = (hash ^ static_cast<uint64_t>(data[i])) * FNV_PRIME;
+            }
+
+            return hash;
+        }
+
+        template <typename T>
+        std::span<const T> getStreamSpan(const core::MemoryMappedFile& file, const FileStream& stream)
+        {
+            return std::span<const T>(reinterpret_cast<const T*>(file.getData() + stream.offset), stream.elementCount);
+        }
+
+        bool isStreamValid(const FileStream& stream, const size_t expectedStride, const size_t fileSize)
+        {
+            if (stream.elementCount == 0u)
+            {
+                return true;
+            }
+
+            return stream.elementStride == expectedStride && stream.offset % STREAM_ALIGNMENT == 0u &&
+                   stream.offset + static_cast<uint64_t>(stream.elementCount) * stream.elementStride <= fileSize;
+        }
+    } // namespace
+
+    MeshView MeshData::getView() const
+    {
+        return MeshView{
+            .positions = positions,
+            .normals = normals,
+            .textureCoords = textureCoords,
+            .indices = indices,
+            .indexStride = indexStride,
+            .minBounds = minBounds,
+            .maxBounds = maxBounds,
+            .materialIndex = materialIndex,
+            .meshlets =
+                MeshletView{
+                    .meshlets = meshlets.meshlets,
+                    .bounds = meshlets.bounds,
+                    .vertices = meshlets.vertices,
+                    .triangles = meshlets.triangles,
+                },
+            .lods = lods,
+            .lodIndices = lodIndices,
+        };
+    }
+
+    std::vector<uint32_t> MeshData::getIndicesUint32() const
+    {
+        std::vector<uint32_t> indicesUint32(getIndexCount());
+
+        if (indexStride == sizeof(uint16_t))
+        {
+            widenIndices(std::span(reinterpret_cast<const uint16_t*>(indices.data()), indicesUint32.size()),
+                         indicesUint32);
+        }
+        else
+        {
+            std::memcpy(indicesUint32.data(), indices.data(), indices.size());
+        }
+
+        return indicesUint32;
+    }
+
+    void MeshData::applyTransform(const math::XMMATRIX& transform)
+    {
+        const math::XMMATRIX normalTransform = math::XMMatrixTranspose(math::XMMatrixInverse(nullptr, transform));
+
+        for (math::XMFLOAT3& position : positions)
+        {
+            math::XMStoreFloat3(&position, math::XMVector3TransformCoord(math::XMLoadFloat3(&position), transform));
+        }
+
+        for (math::XMFLOAT3& normal : normals)
+        {
+            math::XMStoreFloat3(&normal, math::XMVector3Normalize(math::XMVector3TransformNormal(
+                                             math::XMLoadFloat3(&normal), normalTransform)));
+        }
+
+        if (math::XMVectorGetX(math::XMMatrixDeterminant(transform)) < 0.0f)
+        {
+            std::vector<uint32_t> indicesUint32 = getIndicesUint32();
+            for (const size_t i : std::views::iota(0u, indicesUint32.size() / 3u))
+            {
+                std::swap(indicesUint32[i * 3u + 1u], indicesUint32[i * 3u + 2u]);
+            }
+
+            if (indexStride == sizeof(uint16_t))
+            {
+                narrowIndices(indicesUint32,
+                              std::span(reinterpret_cast<uint16_t*>(indices.data()), indicesUint32.size()));
+            }
+            else
+            {
+                std::memcpy(indices.data(), indicesUint32.data(), indices.size());
+            }
+        }
+    }
+
+    void MeshData::computeBounds()
+    {
+        if (positions.empty())
+        {
+            minBounds = maxBounds = math::XMFLOAT3(0.0f, 0.0f, 0.0f);
+            return;
+        }
+
+        math::XMVECTOR minVector = math::XMLoadFloat3(&positions.front());
+        math::XMVECTOR maxVector = minVector;
+
+        for (const math::XMFLOAT3& position : positions)
+        {
+            const math::XMVECTOR positionVector = math::XMLoadFloat3(&position);
+
+            minVector = math::XMVectorMin(minVector, positionVector);
+            maxVector = math::XMVectorMax(maxVector, positionVector);
+        }
+
+        math::XMStoreFloat3(&minBounds, minVector);
+        math::XMStoreFloat3(&maxBounds, maxVector);
+    }
+
+    std::wstring MeshCache::getCachePath(const std::wstring_view modelPath)
+    {
+        std::filesystem::path cachePath{modelPath};
+        cachePath.replace_extension(L".hmesh");
+
+        return cachePath.wstring();
+    }
+
+    uint64_t MeshCache::computeSourceHash(const std::wstring_view modelPath)
+    {
+        constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+
+        const core::MemoryMappedFile modelFile(modelPath);
+        if (!modelFile.isValid())
+        {
+            fatalError(std::format("Failed to open model file : {}", wStringToString(modelPath)));
+        }
+
+        uint64_t hash = hashBytes(modelFile.getData(), modelFile.getSize(), FNV_OFFSET_BASIS);
+
+        const std::filesystem::path modelFilePath{modelPath};
+        if (modelFilePath.extension() == L".gltf")
+        {
+            // Directory iteration order is unspecified, so sort the buffer paths to get a stable hash.
+            std::vector<std::filesystem::path> bufferPaths{};
+            for (const auto& directoryEntry : std::filesystem::directory_iterator(modelFilePath.parent_path()))
+            {
+                if (directoryEntry.is_regular_file() && directoryEntry.path().extension() == L".bin")
+                {
+                    bufferPaths.emplace_back(directoryEntry.path());
+                }
+            }
+
+            std::sort(bufferPaths.begin(), bufferPaths.end());
+
+            for (const std::filesystem::path& bufferPath : bufferPaths)
+            {
+                const core::MemoryMappedFile bufferFile(bufferPath.wstring());
+                if (bufferFile.isValid())
+                {
+                    hash = hashBytes(bufferFile.getData(), bufferFile.getSize(), hash);
+                }
+            }
+        }
+
+        return hash;
+    }
+
+    void MeshCache::write(const std::wstring_view cachePath, const uint64_t sourceHash,
+                          const MeshCookSettings& cookSettings, const ModelData& modelData)
+    {
+        // Build the string data blob (texture paths of all materials).
+        std::string stringData{};
+        std::vector<FileMaterial> fileMaterials(modelData.materials.size());
+
+        for (const size_t i : std::views::iota(0ull, modelData.materials.size()))
+        {
+            const MaterialData& material = modelData.materials[i];
+
+            for (const size_t textureType : std::views::iota(0ull, MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                fileMaterials[i].texturePaths[textureType] = FileString{
+                    .offset = static_cast<uint32_t>(stringData.size()),
+                    .length = static_cast<uint32_t>(material.texturePaths[textureType].size()),
+                };
+
+                stringData += material.texturePaths[textureType];
+            }
+
+            fileMaterials[i].samplerIndices = material.samplerIndices;
+            fileMaterials[i].baseColorFactor = material.baseColorFactor;
+        }
+
+        std::vector<FileSampler> fileSamplers{};
+        fileSamplers.reserve(modelData.samplers.size());
+
+        for (const SamplerData& sampler : modelData.samplers)
+        {
+            fileSamplers.emplace_back(FileSampler{
+                .minFilter = sampler.minFilter,
+                .magFilter = sampler.magFilter,
+                .wrapS = sampler.wrapS,
+                .wrapT = sampler.wrapT,
+            });
+        }
+
+        FileHeader header = {
+            .magic = MAGIC,
+            .version = VERSION,
+            .sourceHash = sourceHash,
+            .meshCount = static_cast<uint32_t>(modelData.meshes.size()),
+            .materialCount = static_cast<uint32_t>(modelData.materials.size()),
+            .samplerCount = static_cast<uint32_t>(modelData.samplers.size()),
+            .cookFlags = getCookFlags(cookSettings),
+        };
+
+        header.meshTableOffset = sizeof(FileHeader);
+        header.materialTableOffset = header.meshTableOffset + sizeof(FileMesh) * modelData.meshes.size();
+        header.samplerTableOffset = header.materialTableOffset + sizeof(FileMaterial) * fileMaterials.size();
+        header.stringDataOffset = header.samplerTableOffset + sizeof(FileSampler) * fileSamplers.size();
+        header.stringDataSize = stringData.size();
+
+        // Compute the (aligned) offset of every stream.
+        std::vector<FileMesh> fileMeshes(modelData.meshes.size());
+        std::vector<std::span<const std::byte>> streamData{};
+
+        uint64_t currentOffset = header.stringDataOffset + header.stringDataSize;
+
+        const auto addStream = [&](FileStream& fileStream, const std::span<const std::byte> data,
+                                   const uint32_t elementCount, const uint32_t elementStride) {
+            currentOffset = alignUp(currentOffset, STREAM_ALIGNMENT);
+
+            fileStream = FileStream{
+                .offset = currentOffset,
+                .elementCount = elementCount,
+                .elementStride = elementStride,
+            };
+
+            streamData.emplace_back(data);
+            currentOffset += data.size();
+        };
+
+        for (const size_t i : std::views::iota(0ull, modelData.meshes.size()))
+        {
+            const MeshData& mesh = modelData.meshes[i];
+            FileMesh& fileMesh = fileMeshes[i];
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::Positions)],
+                      std::as_bytes(std::span(mesh.positions)), static_cast<uint32_t>(mesh.positions.size()),
+                      sizeof(math::XMFLOAT3));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::Normals)], std::as_bytes(std::span(mesh.normals)),
+                      static_cast<uint32_t>(mesh.normals.size()), sizeof(math::XMFLOAT3));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::TextureCoords)],
+                      std::as_bytes(std::span(mesh.textureCoords)), static_cast<uint32_t>(mesh.textureCoords.size()),
+                      sizeof(math::XMFLOAT2));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::Indices)], mesh.indices, mesh.getIndexCount(),
+                      mesh.indexStride);
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::Meshlets)],
+                      std::as_bytes(std::span(mesh.meshlets.meshlets)),
+                      static_cast<uint32_t>(mesh.meshlets.meshlets.size()), sizeof(Meshlet));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::MeshletBounds)],
+                      std::as_bytes(std::span(mesh.meshlets.bounds)),
+                      static_cast<uint32_t>(mesh.meshlets.bounds.size()), sizeof(MeshletBounds));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::MeshletVertices)],
+                      std::as_bytes(std::span(mesh.meshlets.vertices)),
+                      static_cast<uint32_t>(mesh.meshlets.vertices.size()), sizeof(uint32_t));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::MeshletTriangles)],
+                      std::as_bytes(std::span(mesh.meshlets.triangles)),
+                      static_cast<uint32_t>(mesh.meshlets.triangles.size()), sizeof(uint32_t));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::Lods)], std::as_bytes(std::span(mesh.lods)),
+                      static_cast<uint32_t>(mesh.lods.size()), sizeof(MeshLod));
+
+            addStream(fileMesh.streams[enumClassValue(MeshStreamType::LodIndices)], mesh.lodIndices,
+                      static_cast<uint32_t>(mesh.lodIndices.size() / mesh.indexStride), mesh.indexStride);
+
+            fileMesh.minBounds = mesh.minBounds;
+            fileMesh.maxBounds = mesh.maxBounds;
+            fileMesh.materialIndex = mesh.materialIndex;
+            fileMesh.padding = 0u;
+        }
+
+        // Write to a temporary file first and rename it once complete, so that a partially written file (for example if
+        // the application is closed while cooking) is never picked up.
+        const std::filesystem::path finalPath{cachePath};
+        std::filesystem::path temporaryPath{finalPath};
+        temporaryPath += L".tmp";
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                log(std::format(L"Failed to create cooked mesh file : {}.", cachePath));
+                return;
+            }
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+            file.write(reinterpret_cast<const char*>(fileMeshes.data()), sizeof(FileMesh) * fileMeshes.size());
+            file.write(reinterpret_cast<const char*>(fileMaterials.data()),
+                       sizeof(FileMaterial) * fileMaterials.size());
+            file.write(reinterpret_cast<const char*>(fileSamplers.data()), sizeof(FileSampler) * fileSamplers.size());
+            file.write(stringData.data(), stringData.size());
+
+            constexpr std::array<char, STREAM_ALIGNMENT> zeroPadding{};
+
+            for (const std::span<const std::byte> data : streamData)
+            {
+                const uint64_t position = static_cast<uint64_t>(file.tellp());
+                file.write(zeroPadding.data(), alignUp(position, STREAM_ALIGNMENT) - position);
+                file.write(reinterpret_cast<const char*>(data.data()), data.size());
+            }
+
+            if (!file)
+            {
+                log(std::format(L"Failed to write cooked mesh file : {}.", cachePath));
+                return;
+            }
+        }
+
+        std::error_code errorCode{};
+        std::filesystem::rename(temporaryPath, finalPath, errorCode);
+        if (errorCode)
+        {
+            log(std::format(L"Failed to rename cooked mesh file : {}.", cachePath));
+            std::filesystem::remove(temporaryPath, errorCode);
+        }
+    }
+
+    std::optional<MeshCache> MeshCache::open(const std::wstring_view cachePath, const uint64_t sourceHash,
+                                             const MeshCookSettings& cookSettings)
+    {
+        MeshCache meshCache{};
+        meshCache.m_file = core::MemoryMappedFile(cachePath);
+
+        const core::MemoryMappedFile& file = meshCache.m_file;
+        if (!file.isValid() || file.getSize() < sizeof(FileHeader))
+        {
+            return std::nullopt;
+        }
+
+        FileHeader header{};
+        std::memcpy(&header, file.getData(), sizeof(FileHeader));
+
+        if (header.magic != MAGIC || header.version != VERSION || header.sourceHash != sourceHash ||
+            header.cookFlags != getCookFlags(cookSettings))
+        {
+            return std::nullopt;
+        }
+
+        if (header.meshTableOffset + sizeof(FileMesh) * header.meshCount > file.getSize() ||
+            header.materialTableOffset + sizeof(FileMaterial) * header.materialCount > file.getSize() ||
+            header.samplerTableOffset + sizeof(FileSampler) * header.samplerCount > file.getSize() ||
+            header.stringDataOffset + header.stringDataSize > file.getSize())
+        {
+            return std::nullopt;
+        }
+
+        // Meshes : views directly into the mapped file.
+        const FileMesh* fileMeshes = reinterpret_cast<const FileMesh*>(file.getData() + header.meshTableOffset);
+        meshCache.m_meshes.reserve(header.meshCount);
+
+        for (const uint32_t i : std::views::iota(0u, header.meshCount))
+        {
+            const FileMesh& fileMesh = fileMeshes[i];
+
+            const FileStream& positionStream = fileMesh.streams[enumClassValue(MeshStreamType::Positions)];
+            const FileStream& normalStream = fileMesh.streams[enumClassValue(MeshStreamType::Normals)];
+            const FileStream& textureCoordStream = fileMesh.streams[enumClassValue(MeshStreamType::TextureCoords)];
+            const FileStream& indexStream = fileMesh.streams[enumClassValue(MeshStreamType::Indices)];
+
+            const FileStream& meshletStream = fileMesh.streams[enumClassValue(MeshStreamType::Meshlets)];
+            const FileStream& meshletBoundsStream = fileMesh.streams[enumClassValue(MeshStreamType::MeshletBounds)];
+            const FileStream& meshletVertexStream = fileMesh.streams[enumClassValue(MeshStreamType::MeshletVertices)];
+            const FileStream& meshletTriangleStream =
+                fileMesh.streams[enumClassValue(MeshStreamType::MeshletTriangles)];
+
+            const FileStream& lodStream = fileMesh.streams[enumClassValue(MeshStreamType::Lods)];
+            const FileStream& lodIndexStream = fileMesh.streams[enumClassValue(MeshStreamType::LodIndices)];
+
+            if (!isStreamValid(positionStream, sizeof(math::XMFLOAT3), file.getSize()) ||
+                !isStreamValid(normalStream, sizeof(math::XMFLOAT3), file.getSize()) ||
+                !isStreamValid(textureCoordStream, sizeof(math::XMFLOAT2), file.getSize()) ||
+                !isStreamValid(indexStream, indexStream.elementStride == sizeof(uint32_t) ? sizeof(uint32_t)
+                                                                                          : sizeof(uint16_t),
+                               file.getSize()) ||
+                !isStreamValid(meshletStream, sizeof(Meshlet), file.getSize()) ||
+                !isStreamValid(meshletBoundsStream, sizeof(MeshletBounds), file.getSize()) ||
+                !isStreamValid(meshletVertexStream, sizeof(uint32_t), file.getSize()) ||
+                !isStreamValid(meshletTriangleStream, sizeof(uint32_t), file.getSize()) ||
+                !isStreamValid(lodStream, sizeof(MeshLod), file.getSize()) ||
+                !isStreamValid(lodIndexStream, indexStream.elementStride, file.getSize()))
+            {
+                return std::nullopt;
+            }
+
+            meshCache.m_meshes.emplace_back(MeshView{
+                .positions = getStreamSpan<math::XMFLOAT3>(file, positionStream),
+                .normals = getStreamSpan<math::XMFLOAT3>(file, normalStream),
+                .textureCoords = getStreamSpan<math::XMFLOAT2>(file, textureCoordStream),
+                .indices = std::span(file.getData() + indexStream.offset,
+                                     static_cast<size_t>(indexStream.elementCount) * indexStream.elementStride),
+                .indexStride = indexStream.elementStride == 0u ? sizeof(uint16_t) : indexStream.elementStride,
+                .minBounds = fileMesh.minBounds,
+                .maxBounds = fileMesh.maxBounds,
+                .materialIndex = fileMesh.materialIndex,
+                .meshlets =
+                    MeshletView{
+                        .meshlets = getStreamSpan<Meshlet>(file, meshletStream),
+                        .bounds = getStreamSpan<MeshletBounds>(file, meshletBoundsStream),
+                        .vertices = getStreamSpan<uint32_t>(file, meshletVertexStream),
+                        .triangles = getStreamSpan<uint32_t>(file, meshletTriangleStream),
+                    },
+                .lods = getStreamSpan<MeshLod>(file, lodStream),
+                .lodIndices =
+                    std::span(file.getData() + lodIndexStream.offset,
+                              static_cast<size_t>(lodIndexStream.elementCount) * lodIndexStream.elementStride),
+            });
+        }
+
+        // Materials : the table is tiny, so it is decoded into regular MaterialData structs.
+        const FileMaterial* fileMaterials =
+            reinterpret_cast<const FileMaterial*>(file.getData() + header.materialTableOffset);
+        const char* stringData = reinterpret_cast<const char*>(file.getData() + header.stringDataOffset);
+
+        meshCache.m_materials.resize(header.materialCount);
+
+        for (const uint32_t i : std::views::iota(0u, header.materialCount))
+        {
+            for (const size_t textureType : std::views::iota(0ull, MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                const FileString& texturePath = fileMaterials[i].texturePaths[textureType];
+                if (static_cast<uint64_t>(texturePath.offset) + texturePath.length > header.stringDataSize)
+                {
+                    return std::nullopt;
+                }
+
+                meshCache.m_materials[i].texturePaths[textureType] =
+                    std::string(stringData + texturePath.offset, texturePath.length);
+            }
+
+            meshCache.m_materials[i].samplerIndices = fileMaterials[i].samplerIndices;
+            meshCache.m_materials[i].baseColorFactor = fileMaterials[i].baseColorFactor;
+        }
+
+        const FileSampler* fileSamplers =
+            reinterpret_cast<const FileSampler*>(file.getData() + header.samplerTableOffset);
+
+        meshCache.m_samplers.reserve(header.samplerCount);
+        for (const uint32_t i : std::views::iota(0u, header.samplerCount))
+        {
+            meshCache.m_samplers.emplace_back(SamplerData{
+                .minFilter = fileSamplers[i].minFilter,
+                .magFilter = fileSamplers[i].magFilter,
+                .wrapS = fileSamplers[i].wrapS,
+                .wrapT = fileSamplers[i].wrapT,
+            });
+        }
+
+        return meshCache;
+    }
+} // namespace helios::scene
@@ -0,0 +1,415 @@
+#include "Scene/MeshOptimizer.hpp"
+
+#include "Scene/AccessorDecoder.hpp"
+#include "Scene/MeshCache.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        // FIFO cache simulation using timestamps : a vertex is in the cache if it was inserted less than cacheSize
+        // insertions ago.
+        class VertexCacheSimulator
+        {
+          public:
+            VertexCacheSimulator(const uint32_t vertexCount, const uint32_t cacheSize)
+                : m_timestamps(vertexCount, 0u), m_cacheSize(cacheSize), m_currentTime(cacheSize + 1u)
+            {
+            }
+
+            // Returns true if the vertex was not in the cache (i.e it has to be transformed).
+            bool access(const uint32_t vertex)
+            {
+                if (m_currentTime - m_timestamps[vertex] > m_cacheSize)
+                {
+                    m_timestamps[vertex] = m_currentTime++;
+                    return true;
+                }
+
+                return false;
+            }
+
+            void flush()
+            {
+                m_currentTime += m_cacheSize + 1u;
+            }
+
+          private:
+            std::vector<uint32_t> m_timestamps{};
+            uint32_t m_cacheSize{};
+            uint32_t m_currentTime{};
+        };
+
+        // Vertex -> triangle adjacency, stored as offsets into a single triangle list.
+        struct TriangleAdjacency
+        {
+            TriangleAdjacency(std::span<const uint32_t> indices, const uint32_t vertexCount)
+                : counts(vertexCount, 0u), offsets(vertexCount, 0u), triangles(indices.size())
+            {
+                for (const uint32_t index : indices)
+                {
+                    ++counts[index];
+                }
+
+                uint32_t offset{0u};
+                for (const uint32_t vertex : std::views::iota(0u, vertexCount))
+                {
+                    offsets[vertex] = offset;
+                    offset += counts[vertex];
+                }
+
+                std::vector<uint32_t> fillCounts(vertexCount, 0u);
+                for (const size_t i : std::views::iota(0u, indices.size()))
+                {
+                    const uint32_t vertex = indices[i];
+                    triangles[offsets[vertex] + fillCounts[vertex]++] = static_cast<uint32_t>(i / 3u);
+                }
+            }
+
+            std::span<const uint32_t> getTriangles(const uint32_t vertex) const
+            {
+                return std::span(triangles).subspan(offsets[vertex], counts[vertex]);
+            }
+
+            std::vector<uint32_t> counts{};
+            std::vector<uint32_t> offsets{};
+            std::vector<uint32_t> triangles{};
+        };
+
+        math::XMVECTOR loadPosition(std::span<const math::XMFLOAT3> positions, const uint32_t index)
+        {
+            return math::XMLoadFloat3(&positions[index]);
+        }
+    } // namespace
+
+    VertexCacheStatistics MeshOptimizer::analyzeVertexCache(std::span<const uint32_t> indices,
+                                                            const uint32_t vertexCount, const uint32_t cacheSize)
+    {
+        VertexCacheStatistics statistics = {
+            .triangleCount = static_cast<uint32_t>(indices.size() / 3u),
+            .vertexCount = vertexCount,
+        };
+
+        VertexCacheSimulator cache(vertexCount, cacheSize);
+        for (const uint32_t index : indices)
+        {
+            statistics.vertexTransformCount += cache.access(index) ? 1u : 0u;
+        }
+
+        return statistics;
+    }
+
+    void MeshOptimizer::optimizeVertexCache(std::span<uint32_t> indices, const uint32_t vertexCount,
+                                            const uint32_t cacheSize)
+    {
+        const size_t triangleCount = indices.size() / 3u;
+        if (triangleCount == 0u || vertexCount == 0u)
+        {
+            return;
+        }
+
+        const TriangleAdjacency adjacency(indices, vertexCount);
+
+        // Number of triangles that use each vertex and are yet to be emitted.
+        std::vector<uint32_t> liveTriangleCounts = adjacency.counts;
+        std::vector<uint32_t> cacheTimestamps(vertexCount, 0u);
+        std::vector<bool> isTriangleEmitted(triangleCount, false);
+
+        std::vector<uint32_t> deadEndStack{};
+        std::vector<uint32_t> candidates{};
+
+        std::vector<uint32_t> outputIndices{};
+        outputIndices.reserve(indices.size());
+
+        uint32_t currentTime = cacheSize + 1u;
+        uint32_t inputCursor = 0u;
+
+        // Returns the next vertex with live triangles, either from the dead end stack (recently used vertices) or by
+        // scanning the vertices in input order.
+        const auto skipDeadEnd = [&]() -> uint32_t {
+            while (!deadEndStack.empty())
+            {
+                const uint32_t vertex = deadEndStack.back();
+                deadEndStack.pop_back();
+
+                if (liveTriangleCounts[vertex] > 0u)
+                {
+                    return vertex;
+                }
+            }
+
+            for (; inputCursor < vertexCount; ++inputCursor)
+            {
+                if (liveTriangleCounts[inputCursor] > 0u)
+                {
+                    return inputCursor;
+                }
+            }
+
+            return INVALID_INDEX_U32;
+        };
+
+        // Of the vertices used by the last fan, pick the one that will still be in the cache after its remaining
+        // triangles are emitted, preferring the oldest such vertex.
+        const auto getNextVertex = [&]() -> uint32_t {
+            uint32_t nextVertex = INVALID_INDEX_U32;
+            int32_t highestPriority = -1;
+
+            for (const uint32_t vertex : candidates)
+            {
+                if (liveTriangleCounts[vertex] == 0u)
+                {
+                    continue;
+                }
+
+                int32_t priority = 0;
+                if (currentTime - cacheTimestamps[vertex] + 2u * liveTriangleCounts[vertex] <= cacheSize)
+                {
+                    priority = static_cast<int32_t>(currentTime - cacheTimestamps[vertex]);
+                }
+
+                if (priority > highestPriority)
+                {
+                    highestPriority = priority;
+                    nextVertex = vertex;
+                }
+            }
+
+            return nextVertex == INVALID_INDEX_U32 ? skipDeadEnd() : nextVertex;
+        };
+
+        uint32_t fanningVertex = skipDeadEnd();
+        while (fanningVertex != INVALID_INDEX_U32)
+        {
+            candidates.clear();
+
+            for (const uint32_t triangle : adjacency.getTriangles(fanningVertex))
+            {
+                if (isTriangleEmitted[triangle])
+                {
+                    continue;
+                }
+
+                for (const uint32_t corner : std::views::iota(0u, 3u))
+                {
+                    const uint32_t vertex = indices[triangle * 3u + corner];
+
+                    outputIndices.push_back(vertex);
+                    deadEndStack.push_back(vertex);
+                    candidates.push_back(vertex);
+
+                    --liveTriangleCounts[vertex];
+
+                    if (currentTime - cacheTimestamps[vertex] > cacheSize)
+                    {
+                        cacheTimestamps[vertex] = currentTime++;
+                    }
+                }
+
+                isTriangleEmitted[triangle] = true;
+            }
+
+            fanningVertex = getNextVertex();
+        }
+
+        std::copy(outputIndices.begin(), outputIndices.end(), indices.begin());
+    }
+
+    void MeshOptimizer::optimizeOverdraw(std::span<uint32_t> indices, std::span<const math::XMFLOAT3> positions,
+                                         const uint32_t cacheSize, const float threshold)
+    {
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3u);
+        const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+        if (triangleCount == 0u)
+        {
+            return;
+        }
+
+        // Hard boundaries : triangles where the cache was effectively flushed (all three vertices missed), which is
+        // where Tipsify jumped to a new fan.
+        std::vector<uint32_t> hardClusterStarts{};
+        std::vector<uint32_t> triangleCacheMisses(triangleCount, 0u);
+        {
+            VertexCacheSimulator cache(vertexCount, cacheSize);
+            for (const uint32_t triangle : std::views::iota(0u, triangleCount))
+            {
+                for (const uint32_t corner : std::views::iota(0u, 3u))
+                {
+                    triangleCacheMisses[triangle] += cache.access(indices[triangle * 3u + corner]) ? 1u : 0u;
+                }
+
+                if (triangle == 0u || triangleCacheMisses[triangle] == 3u)
+                {
+                    hardClusterStarts.push_back(triangle);
+                }
+            }
+        }
+
+        hardClusterStarts.push_back(triangleCount);
+
+        // Soft boundaries : hard clusters are split further wherever the ACMR of the split cluster (simulated with a
+        // cold cache) is low enough compared to the ACMR of the hard cluster.
+        std::vector<uint32_t> clusterStarts{};
+        {
+            VertexCacheSimulator cache(vertexCount, cacheSize);
+
+            for (const size_t hardCluster : std::views::iota(0u, hardClusterStarts.size() - 1u))
+            {
+                const uint32_t start = hardClusterStarts[hardCluster];
+                const uint32_t end = hardClusterStarts[hardCluster + 1u];
+
+                uint32_t hardClusterMisses{0u};
+                for (const uint32_t triangle : std::views::iota(start, end))
+                {
+                    hardClusterMisses += triangleCacheMisses[triangle];
+                }
+
+                const float clusterThreshold = threshold * static_cast<float>(hardClusterMisses) / (end - start);
+
+                clusterStarts.push_back(start);
+                cache.flush();
+
+                uint32_t clusterMisses{0u};
+                uint32_t clusterSize{0u};
+
+                for (const uint32_t triangle : std::views::iota(start, end))
+                {
+                    for (const uint32_t corner : std::views::iota(0u, 3u))
+                    {
+                        clusterMisses += cache.access(indices[triangle * 3u + corner]) ? 1u : 0u;
+                    }
+
+                    ++clusterSize;
+
+                    if (triangle + 1u < end && static_cast<float>(clusterMisses) <= clusterThreshold * clusterSize)
+                    {
+                        clusterStarts.push_back(triangle + 1u);
+                        cache.flush();
+
+                        clusterMisses = 0u;
+                        clusterSize = 0u;
+                    }
+                }
+            }
+        }
+
+        clusterStarts.push_back(triangleCount);
+
+        const size_t clusterCount = clusterStarts.size() - 1u;
+
+        // Sort clusters by how much they face away from the mesh centroid (outward facing clusters first).
+        math::XMVECTOR meshCentroid = math::XMVectorZero();
+        for (const math::XMFLOAT3& position : positions)
+        {
+            meshCentroid = math::XMVectorAdd(meshCentroid, math::XMLoadFloat3(&position));
+        }
+
+        meshCentroid = math::XMVectorScale(meshCentroid, 1.0f / static_cast<float>(std::max(vertexCount, 1u)));
+
+        std::vector<float> clusterSortKeys(clusterCount, 0.0f);
+        for (const size_t cluster : std::views::iota(0u, clusterCount))
+        {
+            math::XMVECTOR clusterCentroid = math::XMVectorZero();
+            math::XMVECTOR clusterNormal = math::XMVectorZero();
+            float clusterArea{0.0f};
+
+            for (const uint32_t triangle : std::views::iota(clusterStarts[cluster], clusterStarts[cluster + 1u]))
+            {
+                const math::XMVECTOR a = loadPosition(positions, indices[triangle * 3u + 0u]);
+                const math::XMVECTOR b = loadPosition(positions, indices[triangle * 3u + 1u]);
+                const math::XMVECTOR c = loadPosition(positions, indices[triangle * 3u + 2u]);
+
+                // Length of the cross product is twice the triangle area, so the normal sum is area weighted.
+                const math::XMVECTOR normal =
+                    math::XMVector3Cross(math::XMVectorSubtract(b, a), math::XMVectorSubtract(c, a));
+                const float area = math::XMVectorGetX(math::XMVector3Length(normal));
+
+                const math::XMVECTOR triangleCentroid =
+                    math::XMVectorScale(math::XMVectorAdd(math::XMVectorAdd(a, b), c), 1.0f / 3.0f);
+
+                clusterCentroid = math::XMVectorAdd(clusterCentroid, math::XMVectorScale(triangleCentroid, area));
+                clusterNormal = math::XMVectorAdd(clusterNormal, normal);
+                clusterArea += area;
+            }
+
+            if (clusterArea > 0.0f)
+            {
+                clusterCentroid = math::XMVectorScale(clusterCentroid, 1.0f / clusterArea);
+            }
+
+            clusterSortKeys[cluster] = math::XMVectorGetX(math::XMVector3Dot(
+                math::XMVectorSubtract(clusterCentroid, meshCentroid), math::XMVector3Normalize(clusterNormal)));
+        }
+
+        std::vector<uint32_t> clusterOrder(clusterCount);
+        std::iota(clusterOrder.begin(), clusterOrder.end(), 0u);
+        std::stable_sort(clusterOrder.begin(), clusterOrder.end(),
+                         [&](const uint32_t a, const uint32_t b) { return clusterSortKeys[a] > clusterSortKeys[b]; });
+
+        std::vector<uint32_t> outputIndices{};
+        outputIndices.reserve(indices.size());
+
+        for (const uint32_t cluster : clusterOrder)
+        {
+            outputIndices.insert(outputIndices.end(), indices.begin() + clusterStarts[cluster] * 3u,
+                                 indices.begin() + clusterStarts[cluster + 1u] * 3u);
+        }
+
+        std::copy(outputIndices.begin(), outputIndices.end(), indices.begin());
+    }
+
+    std::vector<uint32_t> MeshOptimizer::optimizeVertexFetch(std::span<uint32_t> indices, const uint32_t vertexCount)
+    {
+        std::vector<uint32_t> remapTable(vertexCount, INVALID_INDEX_U32);
+
+        uint32_t nextVertex{0u};
+        for (uint32_t& index : indices)
+        {
+            if (remapTable[index] == INVALID_INDEX_U32)
+            {
+                remapTable[index] = nextVertex++;
+            }
+
+            index = remapTable[index];
+        }
+
+        return remapTable;
+    }
+
+    MeshOptimizationStatistics MeshOptimizer::optimizeMesh(MeshData& meshData)
+    {
+        const uint32_t vertexCount = static_cast<uint32_t>(meshData.positions.size());
+        const uint32_t indexCount = meshData.getIndexCount();
+
+        std::vector<uint32_t> indices = meshData.getIndicesUint32();
+
+        MeshOptimizationStatistics statistics{};
+        statistics.beforeOptimization = analyzeVertexCache(indices, vertexCount);
+
+        optimizeVertexCache(indices, vertexCount);
+        optimizeOverdraw(indices, meshData.positions);
+
+        const std::vector<uint32_t> remapTable = optimizeVertexFetch(indices, vertexCount);
+        const uint32_t newVertexCount = static_cast<uint32_t>(
+            std::count_if(remapTable.begin(), remapTable.end(),
+                          [](const uint32_t index) { return index != INVALID_INDEX_U32; }));
+
+        remapVertexStream(meshData.positions, remapTable, newVertexCount);
+        remapVertexStream(meshData.normals, remapTable, newVertexCount);
+        remapVertexStream(meshData.textureCoords, remapTable, newVertexCount);
+
+        statistics.afterOptimization = analyzeVertexCache(indices, newVertexCount);
+
+        // The vertex count can only decrease, so the index stride does not change.
+        if (meshData.indexStride == sizeof(uint16_t))
+        {
+            narrowIndices(indices, std::span(reinterpret_cast<uint16_t*>(meshData.indices.data()), indexCount));
+        }
+        else
+        {
+            std::memcpy(meshData.indices.data(), indices.data(), meshData.indices.size());
+        }
+
+        return statistics;
+    }
+} // namespace helios::scene
@@ -0,0 +1,610 @@
+#include "Scene/MeshSimplifier.hpp"
+
+#include "Scene/AccessorDecoder.hpp"
+#include "Scene/MeshCache.hpp"
+#include "Scene/MeshOptimizer.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        // Border edges are penalized by adding the quadric of a plane perpendicular to the triangle (through the edge),
+        // scaled by this factor.
+        static constexpr double BORDER_EDGE_WEIGHT = 10.0;
+
+        enum class VertexKind : uint8_t
+        {
+            Manifold, // Single wedge, surrounded by triangles. Can collapse onto any neighbour.
+            Border,   // Single wedge, on an open edge. Can only collapse along the border.
+            Seam,     // Two wedges (attribute discontinuity). Can only collapse along the seam.
+            Locked,   // Non manifold / complex vertices. Never collapsed.
+        };
+
+        // Symmetric 4x4 matrix representing the sum of squared distances to a set of planes, along with the total
+        // weight of the planes (used to normalize the error).
+        struct Quadric
+        {
+            double a2{};
+            double b2{};
+            double c2{};
+            double ab{};
+            double ac{};
+            double bc{};
+            double ad{};
+            double bd{};
+            double cd{};
+            double d2{};
+            double weight{};
+
+            static Quadric fromPlane(const double a, const double b, const double c, const double d,
+                                     const double weight)
+            {
+                return Quadric{
+                    .a2 = a * a * weight,
+                    .b2 = b * b * weight,
+                    .c2 = c * c * weight,
+                    .ab = a * b * weight,
+                    .ac = a * c * weight,
+                    .bc = b * c * weight,
+                    .ad = a * d * weight,
+                    .bd = b * d * weight,
+                    .cd = c * d * weight,
+                    .d2 = d * d * weight,
+                    .weight = weight,
+                };
+            }
+
+            Quadric& operator+=(const Quadric& other)
+            {
+                a2 += other.a2;
+                b2 += other.b2;
+                c2 += other.c2;
+                ab += other.ab;
+                ac += other.ac;
+                bc += other.bc;
+                ad += other.ad;
+                bd += other.bd;
+                cd += other.cd;
+                d2 += other.d2;
+                weight += other.weight;
+
+                return *this;
+            }
+
+            // Returns the (weight normalized) squared distance of the point to the planes.
+            double evaluate(const math::XMFLOAT3& position) const
+            {
+                const double x = position.x;
+                const double y = position.y;
+                const double z = position.z;
+
+                const double error = a2 * x * x + b2 * y * y + c2 * z * z +
+                                     2.0 * (ab * x * y + ac * x * z + bc * y * z) + 2.0 * (ad * x + bd * y + cd * z) +
+                                     d2;
+
+                return weight == 0.0 ? 0.0 : std::max(error / weight, 0.0);
+            }
+        };
+
+        struct PositionHash
+        {
+            size_t operator()(const math::XMFLOAT3& position) const
+            {
+                std::array<uint32_t, 3> bits{};
+                std::memcpy(bits.data(), &position, sizeof(math::XMFLOAT3));
+
+                return (static_cast<size_t>(bits[0]) * 73856093u) ^ (static_cast<size_t>(bits[1]) * 19349663u) ^
+                       (static_cast<size_t>(bits[2]) * 83492791u);
+            }
+        };
+
+        struct PositionEqual
+        {
+            bool operator()(const math::XMFLOAT3& a, const math::XMFLOAT3& b) const
+            {
+                return std::memcmp(&a, &b, sizeof(math::XMFLOAT3)) == 0;
+            }
+        };
+
+        uint64_t getEdgeKey(const uint32_t a, const uint32_t b)
+        {
+            return (static_cast<uint64_t>(a) << 32u) | b;
+        }
+
+        math::XMVECTOR computeTriangleNormal(const math::XMFLOAT3& a, const math::XMFLOAT3& b, const math::XMFLOAT3& c)
+        {
+            const math::XMVECTOR positionA = math::XMLoadFloat3(&a);
+
+            return math::XMVector3Cross(math::XMVectorSubtract(math::XMLoadFloat3(&b), positionA),
+                                        math::XMVectorSubtract(math::XMLoadFloat3(&c), positionA));
+        }
+
+        struct Collapse
+        {
+            // Canonical vertices (i.e the first vertex with a given position) of the edge.
+            uint32_t source{};
+            uint32_t target{};
+            double error{};
+        };
+
+        // Vertex -> triangle adjacency (CSR layout) of a index buffer.
+        struct TriangleAdjacency
+        {
+            explicit TriangleAdjacency(std::span<const uint32_t> indices, const uint32_t vertexCount)
+                : offsets(vertexCount + 1u, 0u), triangles(indices.size())
+            {
+                for (const uint32_t index : indices)
+                {
+                    ++offsets[index + 1u];
+                }
+
+                std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+                std::vector<uint32_t> insertionOffsets(offsets.begin(), offsets.end() - 1u);
+                for (const uint32_t i : std::views::iota(0u, static_cast<uint32_t>(indices.size())))
+                {
+                    triangles[insertionOffsets[indices[i]]++] = i / 3u;
+                }
+            }
+
+            std::span<const uint32_t> getTriangles(const uint32_t vertex) const
+            {
+                return std::span(triangles).subspan(offsets[vertex], offsets[vertex + 1u] - offsets[vertex]);
+            }
+
+            std::vector<uint32_t> offsets{};
+            std::vector<uint32_t> triangles{};
+        };
+    } // namespace
+
+    SimplificationResult MeshSimplifier::simplify(std::span<const uint32_t> indices,
+                                                  std::span<const math::XMFLOAT3> positions,
+                                                  const uint32_t targetIndexCount, const float targetError)
+    {
+        const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+
+        SimplificationResult result{
+            .indices = std::vector<uint32_t>(indices.begin(), indices.end()),
+        };
+
+        // Vertices with the same position (wedges) are linked into a circular list, and all of them map to a single
+        // canonical vertex. Only vertices referenced by the index buffer are considered.
+        std::vector<uint32_t> canonicalVertices(vertexCount, INVALID_INDEX_U32);
+        std::vector<uint32_t> nextWedges(vertexCount, INVALID_INDEX_U32);
+        std::vector<uint32_t> wedgeCounts(vertexCount, 0u);
+
+        {
+            std::unordered_map<math::XMFLOAT3, uint32_t, PositionHash, PositionEqual> positionMap{};
+            positionMap.reserve(vertexCount);
+
+            for (const uint32_t index : indices)
+            {
+                if (canonicalVertices[index] != INVALID_INDEX_U32)
+                {
+                    continue;
+                }
+
+                const auto [iterator, isInserted] = positionMap.try_emplace(positions[index], index);
+                const uint32_t canonicalVertex = iterator->second;
+
+                canonicalVertices[index] = canonicalVertex;
+                ++wedgeCounts[canonicalVertex];
+
+                if (isInserted)
+                {
+                    nextWedges[index] = index;
+                }
+                else
+                {
+                    nextWedges[index] = nextWedges[canonicalVertex];
+                    nextWedges[canonicalVertex] = index;
+                }
+            }
+        }
+
+        const auto forEachWedge = [&](const uint32_t canonicalVertex, const auto& function) {
+            uint32_t wedge = canonicalVertex;
+            do
+            {
+                function(wedge);
+                wedge = nextWedges[wedge];
+            } while (wedge != canonicalVertex);
+        };
+
+        // Classify the (canonical) vertices using the directed edges of the canonical mesh : an edge without a twin is
+        // a border edge, and an edge that appears more than once is non manifold.
+        std::unordered_map<uint64_t, uint32_t> edgeCounts{};
+        edgeCounts.reserve(indices.size());
+
+        for (const size_t i : std::views::iota(0u, indices.size()))
+        {
+            const uint32_t a = canonicalVertices[indices[i]];
+            const uint32_t b = canonicalVertices[indices[i - i % 3u + (i + 1u) % 3u]];
+
+            ++edgeCounts[getEdgeKey(a, b)];
+        }
+
+        std::vector<VertexKind> vertexKinds(vertexCount, VertexKind::Manifold);
+        {
+            std::vector<bool> isBorderVertex(vertexCount, false);
+            std::vector<bool> isNonManifoldVertex(vertexCount, false);
+
+            for (const auto& [edgeKey, count] : edgeCounts)
+            {
+                const uint32_t a = static_cast<uint32_t>(edgeKey >> 32u);
+                const uint32_t b = static_cast<uint32_t>(edgeKey & 0xFFFFFFFFu);
+
+                if (count > 1u || a == b)
+                {
+                    isNonManifoldVertex[a] = isNonManifoldVertex[b] = true;
+                }
+                else if (!edgeCounts.contains(getEdgeKey(b, a)))
+                {
+                    isBorderVertex[a] = isBorderVertex[b] = true;
+                }
+            }
+
+            for (const uint32_t vertex : std::views::iota(0u, vertexCount))
+            {
+                if (canonicalVertices[vertex] != vertex)
+                {
+                    continue;
+                }
+
+                if (isNonManifoldVertex[vertex] || wedgeCounts[vertex] > 2u ||
+                    (isBorderVertex[vertex] && wedgeCounts[vertex] > 1u))
+                {
+                    vertexKinds[vertex] = VertexKind::Locked;
+                }
+                else if (isBorderVertex[vertex])
+                {
+                    vertexKinds[vertex] = VertexKind::Border;
+                }
+                else if (wedgeCounts[vertex] == 2u)
+                {
+                    vertexKinds[vertex] = VertexKind::Seam;
+                }
+            }
+        }
+
+        // Quadrics of the triangle planes (area weighted) and of the border edges.
+        std::vector<Quadric> quadrics(vertexCount);
+        for (const size_t i : std::views::iota(0u, indices.size() / 3u))
+        {
+            const std::array<uint32_t, 3> triangle = {
+                canonicalVertices[indices[i * 3u + 0u]],
+                canonicalVertices[indices[i * 3u + 1u]],
+                canonicalVertices[indices[i * 3u + 2u]],
+            };
+
+            const math::XMVECTOR normal =
+                computeTriangleNormal(positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]);
+
+            const float doubleArea = math::XMVectorGetX(math::XMVector3Length(normal));
+            if (doubleArea == 0.0f)
+            {
+                continue;
+            }
+
+            math::XMFLOAT3 unitNormal{};
+            math::XMStoreFloat3(&unitNormal, math::XMVectorScale(normal, 1.0f / doubleArea));
+
+            const math::XMFLOAT3& position = positions[triangle[0]];
+            const double distance = -(static_cast<double>(unitNormal.x) * position.x +
+                                      static_cast<double>(unitNormal.y) * position.y +
+                                      static_cast<double>(unitNormal.z) * position.z);
+
+            const Quadric triangleQuadric =
+                Quadric::fromPlane(unitNormal.x, unitNormal.y, unitNormal.z, distance, doubleArea * 0.5);
+
+            for (const uint32_t j : std::views::iota(0u, 3u))
+            {
+                quadrics[triangle[j]] += triangleQuadric;
+
+                const uint32_t a = triangle[j];
+                const uint32_t b = triangle[(j + 1u) % 3u];
+
+                if (edgeCounts.contains(getEdgeKey(b, a)))
+                {
+                    continue;
+                }
+
+                const math::XMVECTOR edge =
+                    math::XMVectorSubtract(math::XMLoadFloat3(&positions[b]), math::XMLoadFloat3(&positions[a]));
+                const float edgeLength = math::XMVectorGetX(math::XMVector3Length(edge));
+
+                math::XMFLOAT3 edgeNormal{};
+                math::XMStoreFloat3(&edgeNormal, math::XMVector3Normalize(
+                                                     math::XMVector3Cross(edge, math::XMLoadFloat3(&unitNormal))));
+
+                const double edgeDistance = -(static_cast<double>(edgeNormal.x) * positions[a].x +
+                                              static_cast<double>(edgeNormal.y) * positions[a].y +
+                                              static_cast<double>(edgeNormal.z) * positions[a].z);
+
+                const Quadric edgeQuadric =
+                    Quadric::fromPlane(edgeNormal.x, edgeNormal.y, edgeNormal.z, edgeDistance,
+                                       static_cast<double>(edgeLength) * edgeLength * BORDER_EDGE_WEIGHT);
+
+                quadrics[a] += edgeQuadric;
+                quadrics[b] += edgeQuadric;
+            }
+        }
+
+        const double maxError = static_cast<double>(targetError) * targetError;
+        double resultError{0.0};
+
+        // Maps each vertex to the vertex it was collapsed onto (itself if not collapsed).
+        std::vector<uint32_t> remap(vertexCount);
+        std::iota(remap.begin(), remap.end(), 0u);
+
+        std::vector<bool> isCollapseLocked(vertexCount, false);
+
+        while (result.indices.size() > targetIndexCount)
+        {
+            const TriangleAdjacency adjacency(result.indices, vertexCount);
+
+            std::unordered_set<uint64_t> canonicalEdges{};
+            canonicalEdges.reserve(result.indices.size());
+
+            for (const size_t i : std::views::iota(0u, result.indices.size()))
+            {
+                canonicalEdges.insert(getEdgeKey(canonicalVertices[result.indices[i]],
+                                                 canonicalVertices[result.indices[i - i % 3u + (i + 1u) % 3u]]));
+            }
+
+            const auto isBorderEdge = [&](const uint32_t a, const uint32_t b) {
+                return canonicalEdges.contains(getEdgeKey(a, b)) != canonicalEdges.contains(getEdgeKey(b, a));
+            };
+
+            // Returns the wedge of the canonical vertex that shares a triangle with the given vertex.
+            const auto findNeighbourWedge = [&](const uint32_t vertex, const uint32_t canonicalVertex) {
+                for (const uint32_t triangle : adjacency.getTriangles(vertex))
+                {
+                    for (const uint32_t j : std::views::iota(0u, 3u))
+                    {
+                        const uint32_t neighbour = result.indices[triangle * 3u + j];
+                        if (canonicalVertices[neighbour] == canonicalVertex)
+                        {
+                            return neighbour;
+                        }
+                    }
+                }
+
+                return INVALID_INDEX_U32;
+            };
+
+            const auto isCollapseValid = [&](const uint32_t source, const uint32_t target) {
+                switch (vertexKinds[source])
+                {
+                case VertexKind::Manifold: {
+                    return true;
+                }
+                break;
+
+                case VertexKind::Border: {
+                    return isBorderEdge(source, target);
+                }
+                break;
+
+                case VertexKind::Seam: {
+                    // Both wedges have to be connected to (different) wedges of the target, i.e the edge is along the
+                    // seam.
+                    const uint32_t otherWedge = nextWedges[source];
+
+                    const uint32_t targetWedge = findNeighbourWedge(source, target);
+                    const uint32_t otherTargetWedge = findNeighbourWedge(otherWedge, target);
+
+                    return vertexKinds[target] == VertexKind::Seam && targetWedge != INVALID_INDEX_U32 &&
+                           otherTargetWedge != INVALID_INDEX_U32 && targetWedge != otherTargetWedge;
+                }
+                break;
+
+                case VertexKind::Locked: {
+                    return false;
+                }
+                break;
+                }
+
+                return false;
+            };
+
+            // Gather the candidate collapses, keeping the cheaper direction of each edge.
+            std::vector<Collapse> collapses{};
+            collapses.reserve(result.indices.size());
+
+            for (const size_t i : std::views::iota(0u, result.indices.size()))
+            {
+                const uint32_t a = canonicalVertices[result.indices[i]];
+                const uint32_t b = canonicalVertices[result.indices[i - i % 3u + (i + 1u) % 3u]];
+
+                // Interior edges are visited twice (once per direction), so only consider them from one side.
+                if (a == b || (a > b && !isBorderEdge(a, b)))
+                {
+                    continue;
+                }
+
+                Quadric edgeQuadric = quadrics[a];
+                edgeQuadric += quadrics[b];
+
+                const bool canCollapseAB = isCollapseValid(a, b);
+                const bool canCollapseBA = isCollapseValid(b, a);
+
+                constexpr double INVALID_ERROR = std::numeric_limits<double>::max();
+
+                const double errorAB = canCollapseAB ? edgeQuadric.evaluate(positions[b]) : INVALID_ERROR;
+                const double errorBA = canCollapseBA ? edgeQuadric.evaluate(positions[a]) : INVALID_ERROR;
+
+                if (canCollapseAB || canCollapseBA)
+                {
+                    collapses.emplace_back(errorAB <= errorBA ? Collapse{.source = a, .target = b, .error = errorAB}
+                                                              : Collapse{.source = b, .target = a, .error = errorBA});
+                }
+            }
+
+            std::sort(collapses.begin(), collapses.end(),
+                      [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+            // Returns true if collapsing would flip (or degenerate) any of the triangles that remain.
+            const auto hasTriangleFlips = [&](const uint32_t source, const uint32_t target) {
+                bool hasFlips{false};
+
+                forEachWedge(source, [&](const uint32_t wedge) {
+                    for (const uint32_t triangle : adjacency.getTriangles(wedge))
+                    {
+                        std::array<uint32_t, 3> vertices{};
+                        bool containsTarget{false};
+
+                        for (const uint32_t j : std::views::iota(0u, 3u))
+                        {
+                            vertices[j] = canonicalVertices[remap[result.indices[triangle * 3u + j]]];
+                            containsTarget |= vertices[j] == target;
+                        }
+
+                        // Triangles on the collapsed edge are removed.
+                        if (containsTarget)
+                        {
+                            continue;
+                        }
+
+                        const math::XMVECTOR normal = computeTriangleNormal(
+                            positions[vertices[0]], positions[vertices[1]], positions[vertices[2]]);
+
+                        for (uint32_t& vertex : vertices)
+                        {
+                            vertex = vertex == source ? target : vertex;
+                        }
+
+                        const math::XMVECTOR collapsedNormal = computeTriangleNormal(
+                            positions[vertices[0]], positions[vertices[1]], positions[vertices[2]]);
+
+                        hasFlips |= math::XMVectorGetX(math::XMVector3Dot(normal, collapsedNormal)) <= 0.0f;
+                    }
+                });
+
+                return hasFlips;
+            };
+
+            // Every collapse removes up to two triangles. Vertices involved in a collapse are locked for the rest of
+            // the pass, which keeps the remap table at most one level deep.
+            const size_t triangleCollapseGoal = (result.indices.size() - targetIndexCount) / 3u;
+            size_t collapsedTriangleCount{0u};
+
+            std::fill(isCollapseLocked.begin(), isCollapseLocked.end(), false);
+
+            for (const Collapse& collapse : collapses)
+            {
+                if (collapse.error > maxError || collapsedTriangleCount >= triangleCollapseGoal)
+                {
+                    break;
+                }
+
+                if (isCollapseLocked[collapse.source] || isCollapseLocked[collapse.target] ||
+                    hasTriangleFlips(collapse.source, collapse.target))
+                {
+                    continue;
+                }
+
+                // Move every wedge of the source onto the wedge of the target it shares a triangle with.
+                forEachWedge(collapse.source, [&](const uint32_t wedge) {
+                    const uint32_t targetWedge = findNeighbourWedge(wedge, collapse.target);
+                    remap[wedge] = targetWedge == INVALID_INDEX_U32 ? collapse.target : targetWedge;
+                });
+
+                quadrics[collapse.target] += quadrics[collapse.source];
+
+                isCollapseLocked[collapse.source] = isCollapseLocked[collapse.target] = true;
+
+                resultError = std::max(resultError, collapse.error);
+                collapsedTriangleCount += isBorderEdge(collapse.source, collapse.target) ? 1u : 2u;
+            }
+
+            if (collapsedTriangleCount == 0u)
+            {
+                break;
+            }
+
+            // Apply the remap, and remove the triangles that became degenerate.
+            size_t writeIndex{0u};
+            for (const size_t i : std::views::iota(0u, result.indices.size() / 3u))
+            {
+                const uint32_t a = remap[result.indices[i * 3u + 0u]];
+                const uint32_t b = remap[result.indices[i * 3u + 1u]];
+                const uint32_t c = remap[result.indices[i * 3u + 2u]];
+
+                if (canonicalVertices[a] == canonicalVertices[b] || canonicalVertices[b] == canonicalVertices[c] ||
+                    canonicalVertices[a] == canonicalVertices[c])
+                {
+                    continue;
+                }
+
+                result.indices[writeIndex++] = a;
+                result.indices[writeIndex++] = b;
+                result.indices[writeIndex++] = c;
+            }
+
+            result.indices.resize(writeIndex);
+
+            // Collapsed vertices are no longer referenced, so the remap table can be reset for the next pass.
+            std::iota(remap.begin(), remap.end(), 0u);
+        }
+
+        result.error = static_cast<float>(std::sqrt(resultError));
+
+        return result;
+    }
+
+    void MeshSimplifier::generateLods(MeshData& meshData, const uint32_t lodCount)
+    {
+        meshData.lods.clear();
+        meshData.lodIndices.clear();
+
+        const uint32_t vertexCount = static_cast<uint32_t>(meshData.positions.size());
+
+        std::vector<uint32_t> previousIndices = meshData.getIndicesUint32();
+        std::vector<uint32_t> lodIndices{};
+        float accumulatedError{0.0f};
+
+        for ([[maybe_unused]] const uint32_t lod : std::views::iota(1u, std::max(lodCount, 1u)))
+        {
+            const uint32_t targetIndexCount =
+                static_cast<uint32_t>(previousIndices.size() / 3u * LOD_REDUCTION_RATIO) * 3u;
+
+            SimplificationResult simplificationResult =
+                simplify(previousIndices, meshData.positions, targetIndexCount);
+
+            if (simplificationResult.indices.empty() ||
+                simplificationResult.indices.size() > previousIndices.size() * MIN_LOD_REDUCTION_RATIO)
+            {
+                break;
+            }
+
+            MeshOptimizer::optimizeVertexCache(simplificationResult.indices, vertexCount);
+
+            accumulatedError += simplificationResult.error;
+
+            meshData.lods.emplace_back(MeshLod{
+                .indexOffset = static_cast<uint32_t>(lodIndices.size()),
+                .indexCount = static_cast<uint32_t>(simplificationResult.indices.size()),
+                .error = accumulatedError,
+            });
+
+            lodIndices.insert(lodIndices.end(), simplificationResult.indices.begin(),
+                              simplificationResult.indices.end());
+
+            previousIndices = std::move(simplificationResult.indices);
+        }
+
+        // LOD's use the same vertices, so the index stride of the source mesh is used.
+        meshData.lodIndices.resize(lodIndices.size() * meshData.indexStride);
+
+        if (meshData.indexStride == sizeof(uint16_t))
+        {
+            narrowIndices(lodIndices,
+                          std::span(reinterpret_cast<uint16_t*>(meshData.lodIndices.data()), lodIndices.size()));
+        }
+        else
+        {
+            std::memcpy(meshData.lodIndices.data(), lodIndices.data(), meshData.lodIndices.size());
+        }
+    }
+} // namespace helios::scene
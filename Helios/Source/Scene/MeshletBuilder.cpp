@@ -0,0 +1,323 @@
+#include "Scene/MeshletBuilder.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        // Meshlets whose normals are spread more than this (cosine of the angle between the cone axis and the furthest
+        // normal) can almost never be culled, so the cone is disabled for them.
+        static constexpr float MIN_CONE_DOT = 0.1f;
+
+        // Returns the index of the position (from the given vertex list) that is furthest from the given point.
+        uint32_t getFurthestVertex(std::span<const uint32_t> vertices, std::span<const math::XMFLOAT3> positions,
+                                   const math::XMVECTOR point)
+        {
+            uint32_t furthestVertex = vertices.front();
+            float maxDistanceSquared = -1.0f;
+
+            for (const uint32_t vertex : vertices)
+            {
+                const float distanceSquared = math::XMVectorGetX(
+                    math::XMVector3LengthSq(math::XMVectorSubtract(math::XMLoadFloat3(&positions[vertex]), point)));
+
+                if (distanceSquared > maxDistanceSquared)
+                {
+                    maxDistanceSquared = distanceSquared;
+                    furthestVertex = vertex;
+                }
+            }
+
+            return furthestVertex;
+        }
+    } // namespace
+
+    MeshletData MeshletBuilder::buildMeshlets(std::span<const uint32_t> indices,
+                                              std::span<const math::XMFLOAT3> positions, const uint32_t maxVertices,
+                                              const uint32_t maxTriangles)
+    {
+        if (maxVertices < 3u || maxVertices > 256u || maxTriangles == 0u)
+        {
+            fatalError("Meshlet limits must allow at least a single triangle, and vertex count must fit in 8 bits.");
+        }
+
+        const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3u);
+
+        // Vertex -> triangle adjacency (CSR layout).
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1u, 0u);
+        for (const uint32_t index : indices)
+        {
+            ++adjacencyOffsets[index + 1u];
+        }
+
+        std::inclusive_scan(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+
+        std::vector<uint32_t> adjacentTriangles(triangleCount * 3u);
+        {
+            std::vector<uint32_t> insertionOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1u);
+            for (const uint32_t i : std::views::iota(0u, triangleCount * 3u))
+            {
+                adjacentTriangles[insertionOffsets[indices[i]]++] = i / 3u;
+            }
+        }
+
+        MeshletData meshletData{};
+        Meshlet currentMeshlet{};
+
+        std::vector<bool> isTriangleEmitted(triangleCount, false);
+        std::vector<uint32_t> localVertexIndices(vertexCount, INVALID_INDEX_U32);
+
+        // Number of vertices the triangle would add to the current meshlet (degenerate triangles are handled by
+        // checking for duplicates).
+        const auto getNewVertexCount = [&](const uint32_t triangle) {
+            const uint32_t a = indices[triangle * 3u + 0u];
+            const uint32_t b = indices[triangle * 3u + 1u];
+            const uint32_t c = indices[triangle * 3u + 2u];
+
+            uint32_t newVertexCount = localVertexIndices[a] == INVALID_INDEX_U32 ? 1u : 0u;
+            newVertexCount += (localVertexIndices[b] == INVALID_INDEX_U32 && b != a) ? 1u : 0u;
+            newVertexCount += (localVertexIndices[c] == INVALID_INDEX_U32 && c != a && c != b) ? 1u : 0u;
+
+            return newVertexCount;
+        };
+
+        const auto getTriangleCentroid = [&](const uint32_t triangle) {
+            const math::XMVECTOR a = math::XMLoadFloat3(&positions[indices[triangle * 3u + 0u]]);
+            const math::XMVECTOR b = math::XMLoadFloat3(&positions[indices[triangle * 3u + 1u]]);
+            const math::XMVECTOR c = math::XMLoadFloat3(&positions[indices[triangle * 3u + 2u]]);
+
+            return math::XMVectorScale(math::XMVectorAdd(math::XMVectorAdd(a, b), c), 1.0f / 3.0f);
+        };
+
+        // Sum of the centroids of all triangles in the current meshlet, used to keep meshlets compact.
+        math::XMVECTOR meshletPositionSum = math::XMVectorZero();
+
+        const auto addTriangle = [&](const uint32_t triangle) {
+            std::array<uint32_t, 3> localIndices{};
+            for (const uint32_t i : std::views::iota(0u, 3u))
+            {
+                const uint32_t vertex = indices[triangle * 3u + i];
+                if (localVertexIndices[vertex] == INVALID_INDEX_U32)
+                {
+                    localVertexIndices[vertex] = currentMeshlet.vertexCount++;
+                    meshletData.vertices.emplace_back(vertex);
+                }
+
+                localIndices[i] = localVertexIndices[vertex];
+            }
+
+            meshletData.triangles.emplace_back(packTriangle(localIndices[0], localIndices[1], localIndices[2]));
+            meshletPositionSum = math::XMVectorAdd(meshletPositionSum, getTriangleCentroid(triangle));
+            ++currentMeshlet.triangleCount;
+
+            isTriangleEmitted[triangle] = true;
+        };
+
+        const auto flushMeshlet = [&]() {
+            for (const uint32_t i : std::views::iota(currentMeshlet.vertexOffset, meshletData.vertices.size()))
+            {
+                localVertexIndices[meshletData.vertices[i]] = INVALID_INDEX_U32;
+            }
+
+            meshletData.meshlets.emplace_back(currentMeshlet);
+            meshletPositionSum = math::XMVectorZero();
+
+            currentMeshlet = Meshlet{
+                .vertexOffset = static_cast<uint32_t>(meshletData.vertices.size()),
+                .triangleOffset = static_cast<uint32_t>(meshletData.triangles.size()),
+            };
+        };
+
+        uint32_t seedTriangle{0u};
+
+        for ([[maybe_unused]] const uint32_t i : std::views::iota(0u, triangleCount))
+        {
+            // Find the triangle adjacent to the current meshlet that adds the fewest new vertices. Ties are broken by
+            // the distance to the center of the meshlet, which keeps meshlets round rather than long strips (and hence
+            // gives tighter bounds).
+            uint32_t bestTriangle = INVALID_INDEX_U32;
+            uint32_t bestNewVertexCount = std::numeric_limits<uint32_t>::max();
+            float bestDistanceSquared = std::numeric_limits<float>::max();
+
+            const math::XMVECTOR meshletCenter = math::XMVectorScale(
+                meshletPositionSum, 1.0f / static_cast<float>(std::max(currentMeshlet.triangleCount, 1u)));
+
+            for (const uint32_t vertex : std::span(meshletData.vertices).subspan(currentMeshlet.vertexOffset))
+            {
+                for (const uint32_t j : std::views::iota(adjacencyOffsets[vertex], adjacencyOffsets[vertex + 1u]))
+                {
+                    const uint32_t triangle = adjacentTriangles[j];
+                    if (isTriangleEmitted[triangle])
+                    {
+                        continue;
+                    }
+
+                    const uint32_t newVertexCount = getNewVertexCount(triangle);
+                    if (newVertexCount > bestNewVertexCount)
+                    {
+                        continue;
+                    }
+
+                    const float distanceSquared = math::XMVectorGetX(math::XMVector3LengthSq(
+                        math::XMVectorSubtract(getTriangleCentroid(triangle), meshletCenter)));
+
+                    if (newVertexCount < bestNewVertexCount || distanceSquared < bestDistanceSquared)
+                    {
+                        bestTriangle = triangle;
+                        bestNewVertexCount = newVertexCount;
+                        bestDistanceSquared = distanceSquared;
+                    }
+                }
+            }
+
+            // No adjacent triangles left (or the meshlet is empty), so continue with the next triangle in index
+            // buffer order.
+            if (bestTriangle == INVALID_INDEX_U32)
+            {
+                while (isTriangleEmitted[seedTriangle])
+                {
+                    ++seedTriangle;
+                }
+
+                bestTriangle = seedTriangle;
+                bestNewVertexCount = getNewVertexCount(bestTriangle);
+            }
+
+            if (currentMeshlet.vertexCount + bestNewVertexCount > maxVertices ||
+                currentMeshlet.triangleCount + 1u > maxTriangles)
+            {
+                flushMeshlet();
+            }
+
+            addTriangle(bestTriangle);
+        }
+
+        if (currentMeshlet.triangleCount != 0u)
+        {
+            flushMeshlet();
+        }
+
+        meshletData.bounds.reserve(meshletData.meshlets.size());
+        for (const Meshlet& meshlet : meshletData.meshlets)
+        {
+            meshletData.bounds.emplace_back(computeMeshletBounds(
+                std::span(meshletData.vertices).subspan(meshlet.vertexOffset, meshlet.vertexCount),
+                std::span(meshletData.triangles).subspan(meshlet.triangleOffset, meshlet.triangleCount), positions));
+        }
+
+        return meshletData;
+    }
+
+    MeshletBounds MeshletBuilder::computeMeshletBounds(std::span<const uint32_t> meshletVertices,
+                                                       std::span<const uint32_t> meshletTriangles,
+                                                       std::span<const math::XMFLOAT3> positions)
+    {
+        MeshletBounds bounds{};
+        if (meshletVertices.empty())
+        {
+            return bounds;
+        }
+
+        // Bounding sphere : start with the sphere spanning the two (approximately) furthest apart vertices, and grow it
+        // to include all vertices.
+        // Reference : An Efficient Bounding Sphere (Jack Ritter, Graphics Gems).
+        const uint32_t vertexA =
+            getFurthestVertex(meshletVertices, positions, math::XMLoadFloat3(&positions[meshletVertices.front()]));
+        const uint32_t vertexB = getFurthestVertex(meshletVertices, positions, math::XMLoadFloat3(&positions[vertexA]));
+
+        const math::XMVECTOR positionA = math::XMLoadFloat3(&positions[vertexA]);
+        const math::XMVECTOR positionB = math::XMLoadFloat3(&positions[vertexB]);
+
+        math::XMVECTOR center = math::XMVectorScale(math::XMVectorAdd(positionA, positionB), 0.5f);
+        float radius = math::XMVectorGetX(math::XMVector3Length(math::XMVectorSubtract(positionB, positionA))) * 0.5f;
+
+        for (const uint32_t vertex : meshletVertices)
+        {
+            const math::XMVECTOR offset = math::XMVectorSubtract(math::XMLoadFloat3(&positions[vertex]), center);
+            const float distance = math::XMVectorGetX(math::XMVector3Length(offset));
+
+            if (distance > radius)
+            {
+                const float newRadius = (radius + distance) * 0.5f;
+                center = math::XMVectorAdd(center, math::XMVectorScale(offset, (newRadius - radius) / distance));
+                radius = newRadius;
+            }
+        }
+
+        math::XMStoreFloat3(&bounds.center, center);
+        bounds.radius = radius;
+        bounds.coneApex = bounds.center;
+
+        // Normal cone : the axis is the average of the triangle normals, and the spread is given by the normal that is
+        // furthest from the axis.
+        std::vector<math::XMVECTOR> triangleNormals{};
+        std::vector<math::XMVECTOR> trianglePositions{};
+        triangleNormals.reserve(meshletTriangles.size());
+        trianglePositions.reserve(meshletTriangles.size());
+
+        math::XMVECTOR normalSum = math::XMVectorZero();
+
+        for (const uint32_t triangle : meshletTriangles)
+        {
+            const std::array<uint32_t, 3> localIndices = unpackTriangle(triangle);
+
+            const math::XMVECTOR a = math::XMLoadFloat3(&positions[meshletVertices[localIndices[0]]]);
+            const math::XMVECTOR b = math::XMLoadFloat3(&positions[meshletVertices[localIndices[1]]]);
+            const math::XMVECTOR c = math::XMLoadFloat3(&positions[meshletVertices[localIndices[2]]]);
+
+            const math::XMVECTOR normal =
+                math::XMVector3Cross(math::XMVectorSubtract(b, a), math::XMVectorSubtract(c, a));
+
+            // Degenerate triangles do not contribute to the cone.
+            if (math::XMVectorGetX(math::XMVector3LengthSq(normal)) == 0.0f)
+            {
+                continue;
+            }
+
+            triangleNormals.emplace_back(math::XMVector3Normalize(normal));
+            trianglePositions.emplace_back(a);
+
+            normalSum = math::XMVectorAdd(normalSum, triangleNormals.back());
+        }
+
+        if (triangleNormals.empty() || math::XMVectorGetX(math::XMVector3LengthSq(normalSum)) == 0.0f)
+        {
+            return bounds;
+        }
+
+        const math::XMVECTOR axis = math::XMVector3Normalize(normalSum);
+
+        float minDot = 1.0f;
+        for (const math::XMVECTOR& normal : triangleNormals)
+        {
+            minDot = std::min(minDot, math::XMVectorGetX(math::XMVector3Dot(axis, normal)));
+        }
+
+        math::XMStoreFloat3(&bounds.coneAxis, axis);
+
+        if (minDot <= MIN_CONE_DOT)
+        {
+            return bounds;
+        }
+
+        // The apex is moved back along the axis until it is behind the plane of every triangle, which makes the cone
+        // test conservative for perspective projections.
+        float maxDistance = 0.0f;
+        for (const size_t i : std::views::iota(0u, triangleNormals.size()))
+        {
+            const float centerDistance = math::XMVectorGetX(
+                math::XMVector3Dot(math::XMVectorSubtract(center, trianglePositions[i]), triangleNormals[i]));
+            const float axisDot = math::XMVectorGetX(math::XMVector3Dot(axis, triangleNormals[i]));
+
+            maxDistance = std::max(maxDistance, centerDistance / axisDot);
+        }
+
+        math::XMStoreFloat3(&bounds.coneApex, math::XMVectorSubtract(center, math::XMVectorScale(axis, maxDistance)));
+
+        // All normals are within acos(minDot) of the axis, so the meshlet is back facing if the view direction is
+        // within (90 degrees - acos(minDot)) of the axis, i.e cos of that angle is sin(acos(minDot)).
+        bounds.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+
+        return bounds;
+    }
+} // namespace helios::scene
@@ -0,0 +1,370 @@
+#include "Scene/MipChainBuilder.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        // Half width (in destination pixels) and shape parameter of the Kaiser window.
+        constexpr float KAISER_WIDTH = 3.0f;
+        constexpr float KAISER_ALPHA = 4.0f;
+
+        struct FilterTap
+        {
+            uint32_t sourceIndex{};
+            float weight{};
+        };
+
+        // Taps of all destination pixels along one axis : the taps of destination pixel i are in
+        // [tapOffsets[i], tapOffsets[i + 1]).
+        struct FilterKernel
+        {
+            std::vector<uint32_t> tapOffsets{};
+            std::vector<FilterTap> taps{};
+
+            std::span<const FilterTap> getTaps(const uint32_t index) const
+            {
+                return std::span(taps).subspan(tapOffsets[index], tapOffsets[index + 1u] - tapOffsets[index]);
+            }
+        };
+
+        uint32_t mirrorIndex(const int32_t index, const uint32_t size)
+        {
+            const int32_t period = static_cast<int32_t>(size) * 2;
+
+            int32_t mirroredIndex = index % period;
+            if (mirroredIndex < 0)
+            {
+                mirroredIndex += period;
+            }
+
+            return static_cast<uint32_t>(mirroredIndex < static_cast<int32_t>(size) ? mirroredIndex
+                                                                                     : period - 1 - mirroredIndex);
+        }
+
+        // Modified Bessel function of the first kind (order 0), evaluated with its power series.
+        float besselI0(const float x)
+        {
+            const float halfXSquared = x * x * 0.25f;
+
+            float sum{1.0f};
+            float term{1.0f};
+
+            for (const uint32_t k : std::views::iota(1u, 32u))
+            {
+                term *= halfXSquared / static_cast<float>(k * k);
+                sum += term;
+
+                if (term < sum * 1e-8f)
+                {
+                    break;
+                }
+            }
+
+            return sum;
+        }
+
+        // x is the distance to the center of the destination pixel, in destination pixels.
+        float evaluateKaiser(const float x)
+        {
+            if (std::abs(x) >= KAISER_WIDTH)
+            {
+                return 0.0f;
+            }
+
+            const float sinc = std::abs(x) < 1e-5f ? 1.0f : std::sin(math::XM_PI * x) / (math::XM_PI * x);
+
+            const float t = x / KAISER_WIDTH;
+            return sinc * besselI0(KAISER_ALPHA * std::sqrt(1.0f - t * t)) / besselI0(KAISER_ALPHA);
+        }
+
+        FilterKernel buildFilterKernel(const uint32_t sourceSize, const uint32_t destinationSize,
+                                       const MipFilter filter)
+        {
+            const float scale = static_cast<float>(sourceSize) / static_cast<float>(destinationSize);
+            const float radius = filter == MipFilter::Box ? scale * 0.5f : KAISER_WIDTH * scale;
+
+            FilterKernel filterKernel{};
+            filterKernel.tapOffsets.reserve(destinationSize + 1u);
+
+            for (const uint32_t destinationIndex : std::views::iota(0u, destinationSize))
+            {
+                const uint32_t firstTap = static_cast<uint32_t>(filterKernel.taps.size());
+                filterKernel.tapOffsets.push_back(firstTap);
+
+                const float center = (static_cast<float>(destinationIndex) + 0.5f) * scale;
+                const int32_t firstSourceIndex = static_cast<int32_t>(std::floor(center - radius));
+                const int32_t lastSourceIndex = static_cast<int32_t>(std::ceil(center + radius));
+
+                float totalWeight{};
+                for (const int32_t sourceIndex : std::views::iota(firstSourceIndex, lastSourceIndex))
+                {
+                    float weight{};
+                    if (filter == MipFilter::Box)
+                    {
+                        // Overlap of the source pixel with the footprint of the destination pixel.
+                        weight = std::min(static_cast<float>(sourceIndex + 1), center + radius) -
+                                 std::max(static_cast<float>(sourceIndex), center - radius);
+                    }
+                    else
+                    {
+                        weight = evaluateKaiser((static_cast<float>(sourceIndex) + 0.5f - center) / scale);
+                    }
+
+                    // Kaiser weights can be negative (the lobes of the sinc), box weights can not.
+                    if (filter == MipFilter::Box ? weight <= 0.0f : weight == 0.0f)
+                    {
+                        continue;
+                    }
+
+                    filterKernel.taps.emplace_back(FilterTap{
+                        .sourceIndex = mirrorIndex(sourceIndex, sourceSize),
+                        .weight = weight,
+                    });
+
+                    totalWeight += weight;
+                }
+
+                for (FilterTap& tap : std::span(filterKernel.taps).subspan(firstTap))
+                {
+                    tap.weight /= totalWeight;
+                }
+            }
+
+            filterKernel.tapOffsets.push_back(static_cast<uint32_t>(filterKernel.taps.size()));
+
+            return filterKernel;
+        }
+
+        const std::array<float, 256>& getSRGBToLinearTable()
+        {
+            static const std::array<float, 256> srgbToLinearTable = []() {
+                std::array<float, 256> table{};
+                for (const uint32_t i : std::views::iota(0u, 256u))
+                {
+                    const float value = static_cast<float>(i) / 255.0f;
+                    table[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+                }
+
+                return table;
+            }();
+
+            return srgbToLinearTable;
+        }
+
+        uint8_t encodeComponent(const float value, const bool isSRGB)
+        {
+            float encodedValue = std::clamp(value, 0.0f, 1.0f);
+            if (isSRGB)
+            {
+                encodedValue = encodedValue <= 0.0031308f ? encodedValue * 12.92f
+                                                          : 1.055f * std::pow(encodedValue, 1.0f / 2.4f) - 0.055f;
+            }
+
+            return static_cast<uint8_t>(std::round(encodedValue * 255.0f));
+        }
+
+        // Decodes a row of RGBA8 pixels into linear values in [0, 1] (alpha is always linear).
+        void decodeRow(const uint8_t* const row, const uint32_t width, const bool isSRGB,
+                       std::span<math::XMVECTOR> decodedRow)
+        {
+            const std::array<float, 256>& srgbToLinearTable = getSRGBToLinearTable();
+
+            for (const uint32_t x : std::views::iota(0u, width))
+            {
+                const uint8_t* const pixel = &row[x * 4u];
+
+                if (isSRGB)
+                {
+                    decodedRow[x] = math::XMVectorSet(srgbToLinearTable[pixel[0]], srgbToLinearTable[pixel[1]],
+                                                      srgbToLinearTable[pixel[2]], pixel[3] / 255.0f);
+                }
+                else
+                {
+                    decodedRow[x] =
+                        math::XMVectorSet(pixel[0] / 255.0f, pixel[1] / 255.0f, pixel[2] / 255.0f, pixel[3] / 255.0f);
+                }
+            }
+        }
+
+        // Writes the RGB components of the mip level, and the (unquantized) alpha values to alphaValues, so that the
+        // alpha can be scaled before it is quantized.
+        MipLevel downsampleImage(std::span<const uint8_t> pixels, const uint32_t width, const uint32_t height,
+                                 const bool isSRGB, const MipFilter filter, std::vector<float>& alphaValues)
+        {
+            MipLevel mipLevel = {
+                .width = std::max(width / 2u, 1u),
+                .height = std::max(height / 2u, 1u),
+            };
+
+            mipLevel.pixels.resize(static_cast<size_t>(mipLevel.width) * mipLevel.height * 4u);
+            alphaValues.resize(static_cast<size_t>(mipLevel.width) * mipLevel.height);
+
+            const FilterKernel horizontalKernel = buildFilterKernel(width, mipLevel.width, filter);
+            const FilterKernel verticalKernel = buildFilterKernel(height, mipLevel.height, filter);
+
+            // Horizontally filtered source rows are cached in a ring buffer, as the vertical taps of consecutive
+            // destination rows overlap. All rows used by a destination row lie in a range no longer than its tap
+            // count, so they never evict each other.
+            uint32_t cachedRowCount{1u};
+            for (const uint32_t y : std::views::iota(0u, mipLevel.height))
+            {
+                cachedRowCount = std::max(cachedRowCount, static_cast<uint32_t>(verticalKernel.getTaps(y).size()));
+            }
+
+            std::vector<math::XMVECTOR> rowCache(static_cast<size_t>(cachedRowCount) * mipLevel.width);
+            std::vector<uint32_t> cachedRows(cachedRowCount, INVALID_INDEX_U32);
+            std::vector<math::XMVECTOR> decodedRow(width);
+
+            const auto getFilteredRow = [&](const uint32_t sourceY) {
+                const uint32_t slot = sourceY % cachedRowCount;
+                const std::span<math::XMVECTOR> filteredRow =
+                    std::span(rowCache).subspan(static_cast<size_t>(slot) * mipLevel.width, mipLevel.width);
+
+                if (cachedRows[slot] != sourceY)
+                {
+                    decodeRow(&pixels[static_cast<size_t>(sourceY) * width * 4u], width, isSRGB, decodedRow);
+
+                    for (const uint32_t x : std::views::iota(0u, mipLevel.width))
+                    {
+                        math::XMVECTOR sum = math::XMVectorZero();
+                        for (const FilterTap& tap : horizontalKernel.getTaps(x))
+                        {
+                            sum = math::XMVectorMultiplyAdd(decodedRow[tap.sourceIndex],
+                                                            math::XMVectorReplicate(tap.weight), sum);
+                        }
+
+                        filteredRow[x] = sum;
+                    }
+
+                    cachedRows[slot] = sourceY;
+                }
+
+                return std::span<const math::XMVECTOR>(filteredRow);
+            };
+
+            std::vector<math::XMVECTOR> destinationRow(mipLevel.width);
+
+            for (const uint32_t y : std::views::iota(0u, mipLevel.height))
+            {
+                std::fill(destinationRow.begin(), destinationRow.end(), math::XMVectorZero());
+
+                for (const FilterTap& tap : verticalKernel.getTaps(y))
+                {
+                    const std::span<const math::XMVECTOR> filteredRow = getFilteredRow(tap.sourceIndex);
+                    const math::XMVECTOR weight = math::XMVectorReplicate(tap.weight);
+
+                    for (const uint32_t x : std::views::iota(0u, mipLevel.width))
+                    {
+                        destinationRow[x] = math::XMVectorMultiplyAdd(filteredRow[x], weight, destinationRow[x]);
+                    }
+                }
+
+                for (const uint32_t x : std::views::iota(0u, mipLevel.width))
+                {
+                    math::XMFLOAT4 value{};
+                    math::XMStoreFloat4(&value, destinationRow[x]);
+
+                    const size_t pixelIndex = static_cast<size_t>(y) * mipLevel.width + x;
+                    uint8_t* const pixel = &mipLevel.pixels[pixelIndex * 4u];
+
+                    pixel[0] = encodeComponent(value.x, isSRGB);
+                    pixel[1] = encodeComponent(value.y, isSRGB);
+                    pixel[2] = encodeComponent(value.z, isSRGB);
+
+                    alphaValues[pixelIndex] = value.w;
+                }
+            }
+
+            return mipLevel;
+        }
+
+        float computeAlphaCoverage(std::span<const float> alphaValues, const float alphaCutoff,
+                                   const float alphaScale)
+        {
+            const size_t coveredPixelCount = std::ranges::count_if(
+                alphaValues, [&](const float alpha) { return alpha * alphaScale > alphaCutoff; });
+
+            return static_cast<float>(coveredPixelCount) / static_cast<float>(alphaValues.size());
+        }
+
+        // The coverage grows with the alpha scale, so the scale is found with a binary search.
+        float findAlphaCoverageScale(std::span<const float> alphaValues, const float alphaCutoff,
+                                     const float targetCoverage)
+        {
+            static constexpr uint32_t SEARCH_ITERATION_COUNT = 16u;
+
+            float minScale{0.0f};
+            float maxScale{4.0f};
+
+            for ([[maybe_unused]] const uint32_t iteration : std::views::iota(0u, SEARCH_ITERATION_COUNT))
+            {
+                const float scale = (minScale + maxScale) * 0.5f;
+                if (computeAlphaCoverage(alphaValues, alphaCutoff, scale) < targetCoverage)
+                {
+                    minScale = scale;
+                }
+                else
+                {
+                    maxScale = scale;
+                }
+            }
+
+            // The coverage changes in steps : the upper bound is returned, so that the coverage never drops below the
+            // target (which would make alpha tested geometry vanish).
+            return maxScale;
+        }
+    } // namespace
+
+    std::vector<MipLevel> MipChainBuilder::buildMipChain(std::span<const uint8_t> pixels, const uint32_t width,
+                                                         const uint32_t height, const bool isSRGB,
+                                                         const MipChainSettings& mipChainSettings)
+    {
+        const uint32_t mipLevelCount = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
+
+        std::vector<MipLevel> mipLevels{};
+        mipLevels.reserve(mipLevelCount - 1u);
+
+        // The coverage is only preserved for images with (partially) transparent pixels.
+        const float alphaCutoff = mipChainSettings.alphaCoverageCutoff;
+        bool preserveAlphaCoverage{};
+        size_t coveredPixelCount{};
+
+        if (alphaCutoff > 0.0f)
+        {
+            for (size_t i = 3u; i < pixels.size(); i += 4u)
+            {
+                preserveAlphaCoverage |= pixels[i] != 255u;
+                coveredPixelCount += pixels[i] / 255.0f > alphaCutoff ? 1u : 0u;
+            }
+        }
+
+        const float targetCoverage = static_cast<float>(coveredPixelCount) / static_cast<float>(pixels.size() / 4u);
+
+        std::span<const uint8_t> sourcePixels = pixels;
+        uint32_t sourceWidth = width;
+        uint32_t sourceHeight = height;
+
+        std::vector<float> alphaValues{};
+
+        while (sourceWidth > 1u || sourceHeight > 1u)
+        {
+            MipLevel mipLevel = downsampleImage(sourcePixels, sourceWidth, sourceHeight, isSRGB,
+                                                mipChainSettings.filter, alphaValues);
+
+            const float alphaScale =
+                preserveAlphaCoverage ? findAlphaCoverageScale(alphaValues, alphaCutoff, targetCoverage) : 1.0f;
+
+            for (const size_t i : std::views::iota(size_t{0u}, alphaValues.size()))
+            {
+                mipLevel.pixels[i * 4u + 3u] = encodeComponent(alphaValues[i] * alphaScale, false);
+            }
+
+            sourceWidth = mipLevel.width;
+            sourceHeight = mipLevel.height;
+
+            sourcePixels = mipLevels.emplace_back(std::move(mipLevel)).pixels;
+        }
+
+        return mipLevels;
+    }
+} // namespace helios::scene
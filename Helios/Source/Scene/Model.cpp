@@ -1,32 +1,183 @@
 #include "Scene/Model.hpp"
 
-#include "stb_image.h"
-
 #include "Core/FileSystem.hpp"
+#include "Core/JobSystem.hpp"
 #include "Graphics/GraphicsDevice.hpp"
+#include "Scene/AccessorDecoder.hpp"
+#include "Scene/MeshOptimizer.hpp"
+#include "Scene/MeshSimplifier.hpp"
+#include "Scene/TextureCache.hpp"
+#include "Scene/TextureCompressor.hpp"
+#include "Scene/VertexQuantization.hpp"
 
 namespace helios::scene
 {
-    void TransformComponent::update()
+    namespace
     {
-        const math::XMVECTOR scalingVector = math::XMLoadFloat3(&scale);
-        const math::XMVECTOR rotationVector = math::XMLoadFloat3(&rotation);
-        const math::XMVECTOR translationVector = math::XMLoadFloat3(&translate);
+        AccessorDesc getAccessorDesc(const tinygltf::Model& model, const int accessorIndex)
+        {
+            const tinygltf::Accessor& accessor = model.accessors[accessorIndex];
 
-        const math::XMMATRIX modelMatrix = math::XMMatrixScalingFromVector(scalingVector) *
-                                           math::XMMatrixRotationRollPitchYawFromVector(rotationVector) *
-                                           math::XMMatrixTranslationFromVector(translationVector);
+            AccessorDesc accessorDesc = {
+                .count = static_cast<uint32_t>(accessor.count),
+                .componentCount = static_cast<uint32_t>(tinygltf::GetNumComponentsInType(accessor.type)),
+                .componentType = static_cast<AccessorComponentType>(accessor.componentType),
+                .normalized = accessor.normalized,
+            };
 
-        const interlop::TransformBuffer transformBufferData = {
-            .modelMatrix = modelMatrix,
-            .inverseModelMatrix = DirectX::XMMatrixInverse(nullptr, modelMatrix),
-        };
+            // Accessors without a buffer view are zero initialized (and usually sparse).
+            if (accessor.bufferView >= 0)
+            {
+                const tinygltf::BufferView& bufferView = model.bufferViews[accessor.bufferView];
+                const tinygltf::Buffer& buffer = model.buffers[bufferView.buffer];
 
-        transformBuffer.update(&transformBufferData);
-    }
+                accessorDesc.data = reinterpret_cast<const std::byte*>(buffer.data.data() + bufferView.byteOffset +
+                                                                       accessor.byteOffset);
+                accessorDesc.byteStride = static_cast<uint32_t>(bufferView.byteStride);
+            }
+
+            if (accessor.sparse.isSparse)
+            {
+                const tinygltf::BufferView& indicesBufferView = model.bufferViews[accessor.sparse.indices.bufferView];
+                const tinygltf::Buffer& indicesBuffer = model.buffers[indicesBufferView.buffer];
+
+                const tinygltf::BufferView& valuesBufferView = model.bufferViews[accessor.sparse.values.bufferView];
+                const tinygltf::Buffer& valuesBuffer = model.buffers[valuesBufferView.buffer];
+
+                accessorDesc.sparse = SparseAccessorDesc{
+                    .count = static_cast<uint32_t>(accessor.sparse.count),
+                    .indices = reinterpret_cast<const std::byte*>(indicesBuffer.data.data() +
+                                                                  indicesBufferView.byteOffset +
+                                                                  accessor.sparse.indices.byteOffset),
+                    .indexComponentType = static_cast<AccessorComponentType>(accessor.sparse.indices.componentType),
+                    .values = reinterpret_cast<const std::byte*>(valuesBuffer.data.data() +
+                                                                 valuesBufferView.byteOffset +
+                                                                 accessor.sparse.values.byteOffset),
+                };
+            }
+
+            return accessorDesc;
+        }
+
+        // Returns the local transform of the node (relative to its parent). glTF matrices are column major and use
+        // column vectors, which is the same memory layout as a row major matrix using row vectors (DirectXMath).
+        math::XMMATRIX getNodeLocalTransform(const tinygltf::Node& node)
+        {
+            if (node.matrix.size() == 16u)
+            {
+                math::XMFLOAT4X4 matrix{};
+                for (const size_t i : std::views::iota(0u, 16u))
+                {
+                    matrix.m[i / 4u][i % 4u] = static_cast<float>(node.matrix[i]);
+                }
+
+                return math::XMLoadFloat4x4(&matrix);
+            }
+
+            math::XMMATRIX localTransform = math::XMMatrixIdentity();
+
+            if (node.scale.size() == 3u)
+            {
+                localTransform *= math::XMMatrixScaling(static_cast<float>(node.scale[0]),
+                                                        static_cast<float>(node.scale[1]),
+                                                        static_cast<float>(node.scale[2]));
+            }
+
+            if (node.rotation.size() == 4u)
+            {
+                localTransform *= math::XMMatrixRotationQuaternion(math::XMVectorSet(
+                    static_cast<float>(node.rotation[0]), static_cast<float>(node.rotation[1]),
+                    static_cast<float>(node.rotation[2]), static_cast<float>(node.rotation[3])));
+            }
+
+            if (node.translation.size() == 3u)
+            {
+                localTransform *= math::XMMatrixTranslation(static_cast<float>(node.translation[0]),
+                                                            static_cast<float>(node.translation[1]),
+                                                            static_cast<float>(node.translation[2]));
+            }
+
+            return localTransform;
+        }
+
+        // Square root of the ratio between the texture coord area and the object space surface area of the mesh, i.e
+        // the number of texture coord units per object space unit of length (used to select the mips to stream in).
+        float computeTextureCoordDensity(const MeshView& meshView)
+        {
+            if (meshView.textureCoords.empty())
+            {
+                return 0.0f;
+            }
+
+            const auto getIndex = [&](const size_t i) -> uint32_t {
+                if (meshView.indexStride == sizeof(uint32_t))
+                {
+                    return reinterpret_cast<const uint32_t*>(meshView.indices.data())[i];
+                }
+
+                return reinterpret_cast<const uint16_t*>(meshView.indices.data())[i];
+            };
+
+            double surfaceArea{};
+            double textureCoordArea{};
+
+            const size_t indexCount = meshView.indices.size() / meshView.indexStride;
+            for (size_t i = 0u; i + 2u < indexCount; i += 3u)
+            {
+                const uint32_t a = getIndex(i);
+                const uint32_t b = getIndex(i + 1u);
+                const uint32_t c = getIndex(i + 2u);
+
+                const math::XMVECTOR positionA = math::XMLoadFloat3(&meshView.positions[a]);
+                const math::XMVECTOR positionB = math::XMLoadFloat3(&meshView.positions[b]);
+                const math::XMVECTOR positionC = math::XMLoadFloat3(&meshView.positions[c]);
+
+                surfaceArea += 0.5f * math::XMVectorGetX(math::XMVector3Length(math::XMVector3Cross(
+                                          math::XMVectorSubtract(positionB, positionA),
+                                          math::XMVectorSubtract(positionC, positionA))));
+
+                const math::XMFLOAT2& uvA = meshView.textureCoords[a];
+                const math::XMFLOAT2& uvB = meshView.textureCoords[b];
+                const math::XMFLOAT2& uvC = meshView.textureCoords[c];
+
+                textureCoordArea +=
+                    0.5f * std::abs((uvB.x - uvA.x) * (uvC.y - uvA.y) - (uvC.x - uvA.x) * (uvB.y - uvA.y));
+            }
+
+            if (surfaceArea <= std::numeric_limits<float>::epsilon())
+            {
+                return 0.0f;
+            }
+
+            return static_cast<float>(std::sqrt(textureCoordArea / surfaceArea));
+        }
 
-    Model::Model(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc)
-        : m_modelName(modelCreationDesc.modelName)
+        void setMaterialTextureIndices(const gfx::TexturePool* const texturePool, const PBRMaterial& material,
+                                       interlop::MaterialData& materialData)
+        {
+            materialData.albedoTextureIndex = getSrvIndex(texturePool, material.albedoTexture);
+            materialData.albedoTextureSamplerIndex = material.albedoTextureSampler.samplerIndex;
+
+            materialData.metalRoughnessTextureIndex = getSrvIndex(texturePool, material.metalRoughnessTexture);
+            materialData.metalRoughnessTextureSamplerIndex = material.metalRoughnessTextureSampler.samplerIndex;
+
+            materialData.normalTextureIndex = getSrvIndex(texturePool, material.normalTexture);
+            materialData.normalTextureSamplerIndex = material.normalTextureSampler.samplerIndex;
+
+            materialData.aoTextureIndex = getSrvIndex(texturePool, material.aoTexture);
+            materialData.aoTextureSamplerIndex = material.aoTextureSampler.samplerIndex;
+
+            materialData.emissiveTextureIndex = getSrvIndex(texturePool, material.emissiveTexture);
+            materialData.emissiveTextureSamplerIndex = material.emissiveTextureSampler.samplerIndex;
+        }
+    } // namespace
+
+    Model::Model(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc,
+                 TransformStore* const transformStore, MaterialTable* const materialTable)
+        : m_graphicsDevice(graphicsDevice), m_transformStore(transformStore), m_materialTable(materialTable),
+          m_modelName(modelCreationDesc.modelName),
+          m_quantizeVertexStreams(modelCreationDesc.quantizeVertexStreams),
+          m_compressTextures(modelCreationDesc.compressTextures), m_streamTextures(modelCreationDesc.streamTextures)
     {
         if (modelCreationDesc.modelPath.find(core::FileSystem::getFullPath(L"")) == std::wstring::npos)
         {
@@ -37,18 +188,14 @@ namespace helios::scene
             m_modelPath = modelCreationDesc.modelPath;
         }
 
-        // Create the transform buffer.
-        m_transformComponent.transformBuffer =
-            graphicsDevice->createBuffer<interlop::TransformBuffer>(gfx::BufferCreationDesc{
-                .usage = gfx::BufferUsage::ConstantBuffer,
-                .name = m_modelName + L" Transform Buffer",
+        if (m_transformStore)
+        {
+            m_transformIndex = m_transformStore->addTransform(TransformCreationDesc{
+                .rotation = modelCreationDesc.rotation,
+                .scale = modelCreationDesc.scale,
+                .translate = modelCreationDesc.translate,
             });
-
-        m_transformComponent.scale = modelCreationDesc.scale;
-        m_transformComponent.rotation = modelCreationDesc.rotation;
-        m_transformComponent.translate = modelCreationDesc.translate;
-
-        m_transformComponent.update();
+        }
 
         const std::string modelPathStr = wStringToString(m_modelPath);
         std::string modelDirectoryPathStr{};
@@ -60,83 +207,115 @@ namespace helios::scene
 
         m_modelDirectory = stringToWString(modelDirectoryPathStr);
 
-        std::string warning{};
-        std::string error{};
+        // If a up to date cooked mesh file exists, create the model from it directly.
+        const std::wstring cachePath = MeshCache::getCachePath(m_modelPath);
+        const uint64_t sourceHash = MeshCache::computeSourceHash(m_modelPath);
 
-        tinygltf::TinyGLTF context{};
+        if (const std::optional<MeshCache> meshCache =
+                MeshCache::open(cachePath, sourceHash, modelCreationDesc.cookSettings);
+            meshCache.has_value())
+        {
+            createResources(graphicsDevice, meshCache->getSamplers(), meshCache->getMaterials(),
+                            meshCache->getMeshes());
 
-        tinygltf::Model model{};
+            return;
+        }
 
-        if (modelPathStr.find(".glb") != std::string::npos)
+        const ModelData modelData = loadGLTFModelData(modelCreationDesc.cookSettings);
+
+        std::vector<MeshView> meshViews{};
+        meshViews.reserve(modelData.meshes.size());
+
+        for (const MeshData& meshData : modelData.meshes)
         {
-            if (!context.LoadBinaryFromFile(&model, &error, &warning, modelPathStr))
-            {
-                if (!error.empty())
-                {
-                    fatalError(error);
-                }
+            meshViews.emplace_back(meshData.getView());
+        }
 
-                if (!warning.empty())
-                {
-                    fatalError(warning);
-                }
-            }
+        // Cook the mesh file while the GPU resources are being created.
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        core::JobCounter cookMeshCounter{};
+
+        jobSystem.submit(
+            [&]() { MeshCache::write(cachePath, sourceHash, modelCreationDesc.cookSettings, modelData); },
+            &cookMeshCounter);
+
+        createResources(graphicsDevice, modelData.samplers, modelData.materials, meshViews);
+
+        jobSystem.wait(cookMeshCounter);
+    }
+
+    Model::~Model()
+    {
+        if (!m_graphicsDevice)
+        {
+            return;
         }
-        else
+
+        for (Mesh& mesh : m_meshes)
         {
-            if (!context.LoadASCIIFromFile(&model, &error, &warning, modelPathStr))
+            for (gfx::Buffer* const buffer :
+                 {&mesh.positionBuffer, &mesh.textureCoordsBuffer, &mesh.normalBuffer, &mesh.indexBuffer,
+                  &mesh.lodIndexBuffer, &mesh.meshBuffer, &mesh.meshlets.meshletBuffer,
+                  &mesh.meshlets.meshletBoundsBuffer, &mesh.meshlets.meshletVertexBuffer,
+                  &mesh.meshlets.meshletTriangleBuffer})
             {
-                if (!error.empty())
-                {
-                    fatalError(error);
-                }
-
-                if (!warning.empty())
-                {
-                    fatalError(warning);
-                }
+                m_graphicsDevice->deferRelease(std::move(*buffer));
             }
         }
 
-        // Load samplers and materials.
-        const std::jthread loadSamplerThread([&]() { loadSamplers(graphicsDevice, model); });
-
-        const std::jthread loadMaterialThread([&]() { loadMaterials(graphicsDevice, model); });
-
-        // Build meshes.
-        const tinygltf::Scene& scene = model.scenes[model.defaultScene];
+        for (const gfx::Sampler& sampler : m_samplers)
+        {
+            m_graphicsDevice->deferRelease(gfx::DescriptorRange{
+                .descriptorHeap = m_graphicsDevice->getSamplerDescriptorHeap(),
+                .index = sampler.samplerIndex,
+            });
+        }
 
-        const std::jthread loadMeshThread([&]() {
-            for (const int& nodeIndex : scene.nodes)
+        // The textures are released once no other material uses them.
+        for (const PBRMaterial& material : m_materials)
+        {
+            for (const gfx::TextureHandle texture : {material.albedoTexture, material.normalTexture, material.aoTexture,
+                                                     material.metalRoughnessTexture, material.emissiveTexture})
             {
-                loadNode(graphicsDevice, modelCreationDesc, nodeIndex, model);
+                m_graphicsDevice->releaseTexture(texture);
             }
-        });
+        }
     }
 
-    void Model::updateMaterialBuffer()
+    math::XMMATRIX Model::getModelMatrix() const
     {
-        for (auto& material : m_materials)
-        {
-            material.materialBuffer.update(&material.materialBufferData);
-        }
+        return m_transformStore ? m_transformStore->getModelMatrix(m_transformIndex) : math::XMMatrixIdentity();
+    }
+
+    float Model::getMaxScale() const
+    {
+        return m_transformStore ? m_transformStore->getMaxScale(m_transformIndex) : 1.0f;
     }
 
     void Model::render(const gfx::GraphicsContext* const graphicsContext,
                        interlop::ModelViewerRenderResources& renderResources) const
     {
+        if (!m_transformStore)
+        {
+            fatalError("Models rendered with a transform must be created with a transform store.");
+            return;
+        }
+
         for (const Mesh& mesh : m_meshes)
         {
             graphicsContext->setIndexBuffer(mesh.indexBuffer);
 
-            renderResources.albedoTextureIndex = m_materials[mesh.materialIndex].albedoTexture.srvIndex;
+            renderResources.albedoTextureIndex =
+                getSrvIndex(m_graphicsDevice->getTexturePool(), m_materials[mesh.materialIndex].albedoTexture);
             renderResources.albedoTextureSamplerIndex =
                 m_materials[mesh.materialIndex].albedoTextureSampler.samplerIndex;
 
             renderResources.normalBufferIndex = mesh.normalBuffer.srvIndex;
             renderResources.positionBufferIndex = mesh.positionBuffer.srvIndex;
             renderResources.textureCoordBufferIndex = mesh.textureCoordsBuffer.srvIndex;
-            renderResources.transformBufferIndex = m_transformComponent.transformBuffer.cbvIndex;
+            renderResources.meshBufferIndex = mesh.meshBuffer.cbvIndex;
+            renderResources.transformBufferIndex = m_transformStore->getSrvIndex();
+            renderResources.transformIndex = m_transformIndex;
 
             graphicsContext->set32BitGraphicsConstants(&renderResources);
             graphicsContext->drawInstanceIndexed(mesh.indicesCount);
@@ -156,40 +335,31 @@ namespace helios::scene
     }
 
     void Model::render(const gfx::GraphicsContext* const graphicsContext,
-                       interlop::DeferredGPassRenderResources& renderResources) const
+                       interlop::DeferredGPassRenderResources& renderResources,
+                       const LodSelectionDesc& lodSelectionDesc) const
     {
-        for (const Mesh& mesh : m_meshes)
+        if (!m_transformStore)
         {
-            graphicsContext->setIndexBuffer(mesh.indexBuffer);
-
-            renderResources.albedoTextureIndex = m_materials[mesh.materialIndex].albedoTexture.srvIndex;
-            renderResources.albedoTextureSamplerIndex =
-                m_materials[mesh.materialIndex].albedoTextureSampler.samplerIndex;
-
-            renderResources.aoTextureIndex = m_materials[mesh.materialIndex].aoTexture.srvIndex;
-            renderResources.aoTextureSamplerIndex = m_materials[mesh.materialIndex].aoTextureSampler.samplerIndex;
-
-            renderResources.emissiveTextureIndex = m_materials[mesh.materialIndex].emissiveTexture.srvIndex;
-            renderResources.emissiveTextureSamplerIndex =
-                m_materials[mesh.materialIndex].emissiveTextureSampler.samplerIndex;
-
-            renderResources.metalRoughnessTextureIndex = m_materials[mesh.materialIndex].metalRoughnessTexture.srvIndex;
-            renderResources.metalRoughnessTextureSamplerIndex =
-                m_materials[mesh.materialIndex].metalRoughnessTextureSampler.samplerIndex;
+            fatalError("Models rendered with a transform must be created with a transform store.");
+            return;
+        }
 
-            renderResources.normalTextureIndex = m_materials[mesh.materialIndex].normalTexture.srvIndex;
-            renderResources.normalTextureSamplerIndex =
-                m_materials[mesh.materialIndex].normalTextureSampler.samplerIndex;
+        const math::XMMATRIX modelMatrix = getModelMatrix();
+        const float maxScale = getMaxScale();
 
-            renderResources.materialBufferIndex = m_materials[mesh.materialIndex].materialBuffer.cbvIndex;
+        for (const Mesh& mesh : m_meshes)
+        {
+            renderResources.materialIndex = m_materials[mesh.materialIndex].materialIndex;
 
             renderResources.normalBufferIndex = mesh.normalBuffer.srvIndex;
             renderResources.positionBufferIndex = mesh.positionBuffer.srvIndex;
             renderResources.textureCoordBufferIndex = mesh.textureCoordsBuffer.srvIndex;
-            renderResources.transformBufferIndex = m_transformComponent.transformBuffer.cbvIndex;
+            renderResources.meshBufferIndex = mesh.meshBuffer.cbvIndex;
+            renderResources.transformBufferIndex = m_transformStore->getSrvIndex();
+            renderResources.transformIndex = m_transformIndex;
 
             graphicsContext->set32BitGraphicsConstants(&renderResources);
-            graphicsContext->drawInstanceIndexed(mesh.indicesCount);
+            drawMesh(graphicsContext, mesh, selectLod(mesh, modelMatrix, maxScale, lodSelectionDesc));
         }
     }
 
@@ -210,18 +380,28 @@ namespace helios::scene
     }
 
     void Model::render(const gfx::GraphicsContext* const graphicsContext,
-                       interlop::ShadowPassRenderResources& renderResources) const
+                       interlop::ShadowPassRenderResources& renderResources,
+                       const LodSelectionDesc& lodSelectionDesc) const
     {
-        for (const Mesh& mesh : m_meshes)
+        if (!m_transformStore)
         {
-            graphicsContext->setIndexBuffer(mesh.indexBuffer);
+            fatalError("Models rendered with a transform must be created with a transform store.");
+            return;
+        }
+
+        const math::XMMATRIX modelMatrix = getModelMatrix();
+        const float maxScale = getMaxScale();
 
+        for (const Mesh& mesh : m_meshes)
+        {
             renderResources.positionBufferIndex = mesh.positionBuffer.srvIndex;
-            renderResources.transformBufferIndex = m_transformComponent.transformBuffer.cbvIndex;
+            renderResources.meshBufferIndex = mesh.meshBuffer.cbvIndex;
+            renderResources.transformBufferIndex = m_transformStore->getSrvIndex();
+            renderResources.transformIndex = m_transformIndex;
 
             graphicsContext->set32BitGraphicsConstants(&renderResources);
 
-            graphicsContext->drawInstanceIndexed(mesh.indicesCount);
+            drawMesh(graphicsContext, mesh, selectLod(mesh, modelMatrix, maxScale, lodSelectionDesc));
         }
     }
 
@@ -239,169 +419,431 @@ namespace helios::scene
         }
     }
 
-    // For slight speed up in model loading, one thread will be used to load / create materials (i.e the material
-    // textures), and one thread will read the mesh and fill the various accessors (position, indices, texture
-    // coord's, etc) into vector so they can be loaded into buffers.
-    void Model::loadNode(const gfx::GraphicsDevice* const device, const ModelCreationDesc& modelCreationDesc,
-                         const uint32_t nodeIndex, const tinygltf::Model& model)
+    uint32_t Model::selectLod(const Mesh& mesh, const math::XMMATRIX& modelMatrix, const float maxScale,
+                              const LodSelectionDesc& lodSelectionDesc) const
     {
-        const tinygltf::Node& node = model.nodes[nodeIndex];
-        if (node.mesh < 0)
+        if (mesh.lods.empty() || lodSelectionDesc.errorThreshold <= 0.0f)
+        {
+            return 0u;
+        }
+
+        // Scale factor that converts a object space error into pixels.
+        float errorToPixels = maxScale * lodSelectionDesc.projectionScale;
+
+        if (!lodSelectionDesc.isOrthographic)
         {
-            // Load children immediately.
-            for (const int& childrenNodeIndex : node.children)
+            // Distance from the camera to the closest point of the bounding sphere. Clamped so that the most detailed
+            // LOD is selected when the camera is inside the bounding sphere.
+            const math::XMVECTOR center =
+                math::XMVector3Transform(math::XMLoadFloat3(&mesh.boundingSphereCenter), modelMatrix);
+            const float centerDistance = math::XMVectorGetX(math::XMVector3Length(
+                math::XMVectorSubtract(center, math::XMLoadFloat3(&lodSelectionDesc.viewPosition))));
+
+            const float distance = centerDistance - mesh.boundingSphereRadius * maxScale;
+            if (distance <= std::numeric_limits<float>::epsilon())
             {
-                loadNode(device, modelCreationDesc, childrenNodeIndex, model);
+                return 0u;
             }
 
+            errorToPixels /= distance;
+        }
+
+        uint32_t selectedLod{0u};
+        for (const MeshLod& lod : mesh.lods)
+        {
+            if (lod.error * errorToPixels > lodSelectionDesc.errorThreshold)
+            {
+                break;
+            }
+
+            ++selectedLod;
+        }
+
+        return selectedLod;
+    }
+
+    void Model::requestTextureMips(gfx::TextureStreamer* const textureStreamer,
+                                   const LodSelectionDesc& lodSelectionDesc) const
+    {
+        if (!m_streamTextures)
+        {
             return;
         }
 
-        const tinygltf::Mesh& nodeMesh = model.meshes[node.mesh];
-        for (const size_t i : std::views::iota(0u, nodeMesh.primitives.size()))
+        const math::XMMATRIX modelMatrix = getModelMatrix();
+        const float maxScale = getMaxScale();
+
+        for (const Mesh& mesh : m_meshes)
         {
-            Mesh mesh{};
+            // Number of texture coord units covered by a pixel at the closest point of the bounding sphere (the most
+            // detailed mip is requested when the camera is inside the bounding sphere).
+            float textureCoordsPerPixel = mesh.textureCoordDensity / (maxScale * lodSelectionDesc.projectionScale);
 
-            const std::wstring meshNumber = std::to_wstring(nodeIndex);
-            const std::wstring meshName = m_modelName + L" Mesh " + std::wstring(meshNumber.c_str());
-
-            std::vector<math::XMFLOAT3> modelPositions{};
-            std::vector<math::XMFLOAT2> modelTextureCoords{};
-            std::vector<math::XMFLOAT3> modelNormals{};
-
-            std::vector<uint16_t> indices{};
-
-            // Reference used :
-            // https://github.com/mateeeeeee/Adria-DX12/blob/fc98468095bf5688a186ca84d94990ccd2f459b0/Adria/Rendering/EntityLoader.cpp.
-
-            // Get Accesor, buffer view and buffer for each attribute (position, textureCoord, normal).
-            tinygltf::Primitive primitive = nodeMesh.primitives[i];
-            const tinygltf::Accessor& indexAccesor = model.accessors[primitive.indices];
-
-            // Position data.
-            const tinygltf::Accessor& positionAccesor = model.accessors[primitive.attributes["POSITION"]];
-            const tinygltf::BufferView& positionBufferView = model.bufferViews[positionAccesor.bufferView];
-            const tinygltf::Buffer& positionBuffer = model.buffers[positionBufferView.buffer];
-
-            const int positionByteStride = positionAccesor.ByteStride(positionBufferView);
-            const uint8_t* positions = &positionBuffer.data[positionBufferView.byteOffset + positionAccesor.byteOffset];
-
-            // TextureCoord data.
-            const tinygltf::Accessor& textureCoordAccesor = model.accessors[primitive.attributes["TEXCOORD_0"]];
-            const tinygltf::BufferView& textureCoordBufferView = model.bufferViews[textureCoordAccesor.bufferView];
-            const tinygltf::Buffer& textureCoordBuffer = model.buffers[textureCoordBufferView.buffer];
-            const int textureCoordBufferStride = textureCoordAccesor.ByteStride(textureCoordBufferView);
-            const uint8_t* texcoords =
-                &textureCoordBuffer.data[textureCoordBufferView.byteOffset + textureCoordAccesor.byteOffset];
-
-            // Normal data.
-            const tinygltf::Accessor& normalAccesor = model.accessors[primitive.attributes["NORMAL"]];
-            const tinygltf::BufferView& normalBufferView = model.bufferViews[normalAccesor.bufferView];
-            const tinygltf::Buffer& normalBuffer = model.buffers[normalBufferView.buffer];
-            const int normalByteStride = normalAccesor.ByteStride(normalBufferView);
-            const uint8_t* normals = &normalBuffer.data[normalBufferView.byteOffset + normalAccesor.byteOffset];
-
-            // Get the index buffer data.
-            const tinygltf::BufferView& indexBufferView = model.bufferViews[indexAccesor.bufferView];
-            const tinygltf::Buffer& indexBuffer = model.buffers[indexBufferView.buffer];
-            const int indexByteStride = indexAccesor.ByteStride(indexBufferView);
-            const uint8_t* indexes = indexBuffer.data.data() + indexBufferView.byteOffset + indexAccesor.byteOffset;
-
-            {
-                const std::jthread vertexAttributesThread([&]() {
-                    {
-                        // Fill in the vertices array.
-                        for (size_t i : std::views::iota(0u, positionAccesor.count))
-                        {
-                            const math::XMFLOAT3 position = {
-                                (reinterpret_cast<float const*>(positions + (i * positionByteStride)))[0],
-                                (reinterpret_cast<float const*>(positions + (i * positionByteStride)))[1],
-                                (reinterpret_cast<float const*>(positions + (i * positionByteStride)))[2],
-                            };
-
-                            const math::XMFLOAT2 textureCoord = {
-                                (reinterpret_cast<float const*>(texcoords + (i * textureCoordBufferStride)))[0],
-                                (reinterpret_cast<float const*>(texcoords + (i * textureCoordBufferStride)))[1],
-                            };
-
-                            const math::XMFLOAT3 normal = {
-                                (reinterpret_cast<float const*>(normals + (i * normalByteStride)))[0],
-                                (reinterpret_cast<float const*>(normals + (i * normalByteStride)))[1],
-                                (reinterpret_cast<float const*>(normals + (i * normalByteStride)))[2],
-                            };
-
-                            modelPositions.emplace_back(position);
-                            modelTextureCoords.emplace_back(textureCoord);
-                            modelNormals.emplace_back(normal);
-                        }
-                    }
-                });
-
-                const std::jthread indexBufferDataThread([&]() {
-                    // Fill indices array.
-                    for (const size_t i : std::views::iota(0u, indexAccesor.count))
-                    {
-                        if (indexAccesor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
-                        {
-                            indices.emplace_back(reinterpret_cast<uint16_t const*>(indexes + (i * indexByteStride))[0]);
-                        }
-                        else if (indexAccesor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
-                        {
-                            indices.emplace_back(reinterpret_cast<uint16_t const*>(indexes + (i * indexByteStride))[0]);
-                        }
-                    }
-                });
-            }
-
-            mesh.positionBuffer = device->createBuffer<math::XMFLOAT3>(
-                gfx::BufferCreationDesc{
-                    .usage = gfx::BufferUsage::StructuredBuffer,
-                    .name = meshName + L" position buffer",
-                },
-                modelPositions);
+            if (!lodSelectionDesc.isOrthographic)
+            {
+                const math::XMVECTOR center =
+                    math::XMVector3Transform(math::XMLoadFloat3(&mesh.boundingSphereCenter), modelMatrix);
+                const float centerDistance = math::XMVectorGetX(math::XMVector3Length(
+                    math::XMVectorSubtract(center, math::XMLoadFloat3(&lodSelectionDesc.viewPosition))));
 
-            mesh.textureCoordsBuffer = device->createBuffer<math::XMFLOAT2>(
-                gfx::BufferCreationDesc{
-                    .usage = gfx::BufferUsage::StructuredBuffer,
-                    .name = meshName + L" texture coord buffer",
-                },
-                modelTextureCoords);
+                textureCoordsPerPixel *= std::max(centerDistance - mesh.boundingSphereRadius * maxScale, 0.0f);
+            }
 
-            mesh.normalBuffer = device->createBuffer<math::XMFLOAT3>(
-                gfx::BufferCreationDesc{
-                    .usage = gfx::BufferUsage::StructuredBuffer,
-                    .name = meshName + L" normal buffer",
-                },
-                modelNormals);
+            const PBRMaterial& material = m_materials[mesh.materialIndex];
+            for (const gfx::TextureHandle texture : {material.albedoTexture, material.normalTexture, material.aoTexture,
+                                                     material.metalRoughnessTexture, material.emissiveTexture})
+            {
+                if (!texture.isNull())
+                {
+                    textureStreamer->requestMip(texture, textureCoordsPerPixel);
+                }
+            }
+        }
+    }
 
-            mesh.indexBuffer = device->createBuffer<uint16_t>(
-                gfx::BufferCreationDesc{
-                    .usage = gfx::BufferUsage::StructuredBuffer,
-                    .name = meshName + L" index buffer",
-                },
-                indices);
+    void Model::updateMaterialTextureIndices() const
+    {
+        if (!m_streamTextures || !m_materialTable)
+        {
+            return;
+        }
+
+        for (const PBRMaterial& material : m_materials)
+        {
+            const interlop::MaterialData& materialData = m_materialTable->getMaterial(material.materialIndex);
 
-            mesh.indicesCount = static_cast<uint32_t>(indices.size());
+            interlop::MaterialData updatedMaterialData = materialData;
+            setMaterialTextureIndices(m_graphicsDevice->getTexturePool(), material, updatedMaterialData);
+
+            if (std::memcmp(&materialData, &updatedMaterialData, sizeof(interlop::MaterialData)) != 0)
+            {
+                m_materialTable->setMaterial(material.materialIndex, updatedMaterialData);
+            }
+        }
+    }
 
-            mesh.materialIndex = primitive.material;
+    void Model::drawMesh(const gfx::GraphicsContext* const graphicsContext, const Mesh& mesh, const uint32_t lod) const
+    {
+        if (lod == 0u)
+        {
+            graphicsContext->setIndexBuffer(mesh.indexBuffer);
+            graphicsContext->drawInstanceIndexed(mesh.indicesCount);
 
-            m_meshes.push_back(mesh);
+            return;
+        }
+
+        const MeshLod& meshLod = mesh.lods[lod - 1u];
+
+        graphicsContext->setIndexBuffer(mesh.lodIndexBuffer);
+        graphicsContext->drawInstanceIndexed(meshLod.indexCount, 1u, meshLod.indexOffset);
+    }
+
+    ModelData Model::loadGLTFModelData(const MeshCookSettings& cookSettings) const
+    {
+        const std::string modelPathStr = wStringToString(m_modelPath);
+
+        std::string warning{};
+        std::string error{};
+
+        tinygltf::TinyGLTF context{};
+
+        tinygltf::Model model{};
+
+        if (modelPathStr.find(".glb") != std::string::npos)
+        {
+            if (!context.LoadBinaryFromFile(&model, &error, &warning, modelPathStr))
+            {
+                if (!error.empty())
+                {
+                    fatalError(error);
+                }
+
+                if (!warning.empty())
+                {
+                    fatalError(warning);
+                }
+            }
+        }
+        else
+        {
+            if (!context.LoadASCIIFromFile(&model, &error, &warning, modelPathStr))
+            {
+                if (!error.empty())
+                {
+                    fatalError(error);
+                }
+
+                if (!warning.empty())
+                {
+                    fatalError(warning);
+                }
+            }
+        }
+
+        ModelData modelData{};
+
+        // Samplers.
+        for (const tinygltf::Sampler& sampler : model.samplers)
+        {
+            modelData.samplers.emplace_back(SamplerData{
+                .minFilter = sampler.minFilter,
+                .magFilter = sampler.magFilter,
+                .wrapS = sampler.wrapS,
+                .wrapT = sampler.wrapT,
+            });
+        }
+
+        // Materials.
+        for (const tinygltf::Material& material : model.materials)
+        {
+            MaterialData materialData{};
+
+            const auto setTexture = [&](const MaterialTextureType textureType, const int textureIndex) {
+                if (textureIndex < 0)
+                {
+                    return;
+                }
+
+                const tinygltf::Texture& texture = model.textures[textureIndex];
+
+                materialData.texturePaths[enumClassValue(textureType)] = model.images[texture.source].uri;
+                materialData.samplerIndices[enumClassValue(textureType)] = texture.sampler;
+            };
+
+            setTexture(MaterialTextureType::Albedo, material.pbrMetallicRoughness.baseColorTexture.index);
+            setTexture(MaterialTextureType::Normal, material.normalTexture.index);
+            setTexture(MaterialTextureType::MetalRoughness,
+                       material.pbrMetallicRoughness.metallicRoughnessTexture.index);
+            setTexture(MaterialTextureType::AO, material.occlusionTexture.index);
+            setTexture(MaterialTextureType::Emissive, material.emissiveTexture.index);
+
+            materialData.baseColorFactor = math::XMFLOAT4(
+                static_cast<float>(material.pbrMetallicRoughness.baseColorFactor[0]),
+                static_cast<float>(material.pbrMetallicRoughness.baseColorFactor[1]),
+                static_cast<float>(material.pbrMetallicRoughness.baseColorFactor[2]),
+                static_cast<float>(material.pbrMetallicRoughness.baseColorFactor[3]));
+
+            modelData.materials.emplace_back(std::move(materialData));
+        }
+
+        // Meshes. The node hierarchy is flattened : the world transform of each node is baked into the vertex data of
+        // its meshes, so the model can be rendered with just the transform of the model itself.
+        const tinygltf::Scene& scene = model.scenes[std::max(model.defaultScene, 0)];
+
+        std::vector<NodePrimitive> nodePrimitives{};
+        for (const int& nodeIndex : scene.nodes)
+        {
+            loadNode(nodePrimitives, nodeIndex, model, math::XMMatrixIdentity());
+        }
+
+        // All meshes are processed in parallel, and each processing stage is a single job per mesh.
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        const uint32_t meshCount = static_cast<uint32_t>(nodePrimitives.size());
+
+        const auto processMeshes = [&](const std::function<void(const uint32_t)>& job) {
+            core::JobCounter counter{};
+            jobSystem.dispatch(meshCount, 1u, job, &counter);
+            jobSystem.wait(counter);
+        };
+
+        modelData.meshes.resize(meshCount);
+        processMeshes([&](const uint32_t i) { modelData.meshes[i] = loadPrimitive(nodePrimitives[i], model); });
+
+        if (cookSettings.optimizeMeshes)
+        {
+            std::vector<MeshOptimizationStatistics> meshStatistics(meshCount);
+            processMeshes(
+                [&](const uint32_t i) { meshStatistics[i] = MeshOptimizer::optimizeMesh(modelData.meshes[i]); });
+
+            MeshOptimizationStatistics statistics{};
+            for (const MeshOptimizationStatistics& meshStatistic : meshStatistics)
+            {
+                statistics.beforeOptimization += meshStatistic.beforeOptimization;
+                statistics.afterOptimization += meshStatistic.afterOptimization;
+            }
+
+            log(std::format(L"Optimized meshes of model {} : ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+                            m_modelName, statistics.beforeOptimization.getACMR(),
+                            statistics.afterOptimization.getACMR(),
+                            statistics.beforeOptimization.getATVR(), statistics.afterOptimization.getATVR()));
+        }
+
+        // LOD's are generated from the optimized meshes, and are only used for rendering (not for meshlets).
+        if (cookSettings.lodCount > 1u)
+        {
+            processMeshes(
+                [&](const uint32_t i) { MeshSimplifier::generateLods(modelData.meshes[i], cookSettings.lodCount); });
+
+            size_t sourceIndexCount{};
+            size_t lodIndexCount{};
+
+            for (const MeshData& meshData : modelData.meshes)
+            {
+                sourceIndexCount += meshData.getIndexCount();
+                lodIndexCount += meshData.lods.empty() ? meshData.getIndexCount() : meshData.lods.back().indexCount;
+            }
+
+            log(std::format(L"Generated LOD's for model {} : {} triangles -> {} triangles (least detailed LOD).",
+                            m_modelName, sourceIndexCount / 3u, lodIndexCount / 3u));
+        }
+
+        // Meshlets are built after optimization, as the builder picks seed triangles in index buffer order.
+        if (cookSettings.buildMeshlets)
+        {
+            processMeshes([&](const uint32_t i) {
+                MeshData& meshData = modelData.meshes[i];
+                meshData.meshlets = MeshletBuilder::buildMeshlets(meshData.getIndicesUint32(), meshData.positions);
+            });
+
+            size_t meshletCount{};
+            for (const MeshData& meshData : modelData.meshes)
+            {
+                meshletCount += meshData.meshlets.meshlets.size();
+            }
+
+            log(std::format(L"Built {} meshlets for model {}.", meshletCount, m_modelName));
+        }
+
+        return modelData;
+    }
+
+    void Model::loadNode(std::vector<NodePrimitive>& nodePrimitives, const uint32_t nodeIndex,
+                         const tinygltf::Model& model, const math::XMMATRIX& parentTransform) const
+    {
+        const tinygltf::Node& node = model.nodes[nodeIndex];
+
+        // DirectXMath uses row vectors, so the local transform is applied first.
+        const math::XMMATRIX nodeTransform = getNodeLocalTransform(node) * parentTransform;
+
+        if (node.mesh >= 0)
+        {
+            for (const tinygltf::Primitive& primitive : model.meshes[node.mesh].primitives)
+            {
+                if (primitive.attributes.contains("POSITION"))
+                {
+                    nodePrimitives.emplace_back(NodePrimitive{
+                        .primitive = &primitive,
+                        .transform = nodeTransform,
+                    });
+                }
+            }
         }
 
         for (const int& childrenNodeIndex : node.children)
         {
-            loadNode(device, modelCreationDesc, childrenNodeIndex, model);
+            loadNode(nodePrimitives, childrenNodeIndex, model, nodeTransform);
+        }
+    }
+
+    // The vertex accessors (position, texture coord's, normals) are decoded on the calling job, while another job
+    // decodes the indices.
+    MeshData Model::loadPrimitive(const NodePrimitive& nodePrimitive, const tinygltf::Model& model) const
+    {
+        const tinygltf::Primitive& primitive = *nodePrimitive.primitive;
+
+        const AccessorDesc positionAccessor = getAccessorDesc(model, primitive.attributes.at("POSITION"));
+
+        MeshData meshData{};
+
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        core::JobCounter indexBufferDataCounter{};
+
+        jobSystem.submit(
+            [&]() {
+                if (primitive.indices >= 0)
+                {
+                    meshData.indexStride = decodeIndexAccessor(getAccessorDesc(model, primitive.indices),
+                                                               positionAccessor.count, meshData.indices);
+
+                    return;
+                }
+
+                // Non indexed primitive, so generate a sequential index buffer.
+                std::vector<uint32_t> indices(positionAccessor.count);
+                std::iota(indices.begin(), indices.end(), 0u);
+
+                if (positionAccessor.count <= 65536u)
+                {
+                    meshData.indexStride = sizeof(uint16_t);
+                    meshData.indices.resize(indices.size() * sizeof(uint16_t));
+
+                    narrowIndices(indices,
+                                  std::span(reinterpret_cast<uint16_t*>(meshData.indices.data()), indices.size()));
+                }
+                else
+                {
+                    meshData.indexStride = sizeof(uint32_t);
+                    meshData.indices.resize(indices.size() * sizeof(uint32_t));
+
+                    std::memcpy(meshData.indices.data(), indices.data(), meshData.indices.size());
+                }
+            },
+            &indexBufferDataCounter);
+
+        meshData.positions = decodeFloat3Accessor(positionAccessor);
+
+        // Normals and texture coords are optional in glTF, and default to zero if not present.
+        if (const auto normalAttribute = primitive.attributes.find("NORMAL");
+            normalAttribute != primitive.attributes.end())
+        {
+            meshData.normals = decodeFloat3Accessor(getAccessorDesc(model, normalAttribute->second));
+        }
+        else
+        {
+            meshData.normals.resize(positionAccessor.count);
         }
+
+        if (const auto textureCoordAttribute = primitive.attributes.find("TEXCOORD_0");
+            textureCoordAttribute != primitive.attributes.end())
+        {
+            meshData.textureCoords = decodeFloat2Accessor(getAccessorDesc(model, textureCoordAttribute->second));
+        }
+        else
+        {
+            meshData.textureCoords.resize(positionAccessor.count);
+        }
+
+        jobSystem.wait(indexBufferDataCounter);
+
+        if (!math::XMMatrixIsIdentity(nodePrimitive.transform))
+        {
+            meshData.applyTransform(nodePrimitive.transform);
+        }
+
+        meshData.computeBounds();
+        meshData.materialIndex = primitive.material;
+
+        return meshData;
+    }
+
+    void Model::createResources(const gfx::GraphicsDevice* const graphicsDevice, std::span<const SamplerData> samplers,
+                                std::span<const MaterialData> materials, std::span<const MeshView> meshes)
+    {
+        // Samplers are created first, as the materials index into m_samplers.
+        loadSamplers(graphicsDevice, samplers);
+
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        core::JobCounter loadMaterialsCounter{};
+
+        jobSystem.submit([&]() { loadMaterials(graphicsDevice, materials); }, &loadMaterialsCounter);
+
+        loadMeshes(graphicsDevice, meshes);
+
+        jobSystem.wait(loadMaterialsCounter);
+
+        // The uploads of textures shared with other models (see TextureCache) have been recorded before this point, so
+        // the latest ticket covers all resources of the model.
+        m_uploadTicket = graphicsDevice->getLatestUploadTicket();
     }
 
     // Reference : https://github.com/syoyo/tinygltf/blob/master/examples/dxview/src/Viewer.cc
-    void Model::loadSamplers(const gfx::GraphicsDevice* const graphicsDevice, const tinygltf::Model& model)
+    void Model::loadSamplers(const gfx::GraphicsDevice* const graphicsDevice, std::span<const SamplerData> samplers)
     {
-        m_samplers.resize(model.samplers.size());
+        m_samplers.resize(samplers.size());
 
         size_t index{0};
 
-        for (const tinygltf::Sampler& sampler : model.samplers)
+        for (const SamplerData& sampler : samplers)
         {
             gfx::SamplerCreationDesc samplerCreationDesc{};
 
@@ -524,147 +966,285 @@ namespace helios::scene
         }
     }
 
-    void Model::loadMaterials(const gfx::GraphicsDevice* graphicsDevice, const tinygltf::Model& model)
+    void Model::loadMaterials(const gfx::GraphicsDevice* graphicsDevice, std::span<const MaterialData> materials)
     {
-        const auto createTexture = [&](const tinygltf::Image& image,
-                                       const gfx::TextureCreationDesc& paramTextureCreationDesc) {
-            const std::string texturePath = wStringToString(m_modelDirectory) + image.uri;
+        // Images that are used by multiple materials (or models) are only loaded once (see TextureCache).
+        const auto createTexture = [&](const std::string_view imagePath,
+                                       const gfx::TextureCreationDesc& textureCreationDesc,
+                                       const MipChainSettings& mipChainSettings) {
+            const std::string texturePath = wStringToString(m_modelDirectory) + std::string(imagePath);
+
+            return TextureCache::get().getTexture(graphicsDevice, texturePath, textureCreationDesc, mipChainSettings,
+                                                  m_streamTextures);
+        };
 
-            gfx::TextureCreationDesc textureCreationDesc = paramTextureCreationDesc;
+        const auto getSampler = [&](const MaterialData& material, const MaterialTextureType textureType) {
+            const int32_t samplerIndex = material.samplerIndices[enumClassValue(textureType)];
+            return samplerIndex >= 0 ? m_samplers[samplerIndex] : gfx::Sampler{};
+        };
+
+        // One job per texture : the textures of all materials are decoded and uploaded in parallel.
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        core::JobCounter textureCounter{};
 
-            int32_t width{}, height{};
-            const unsigned char* data = stbi_load(texturePath.c_str(), &width, &height, nullptr, 4);
-            if (!data)
+        const auto loadTexture = [&](const MaterialData& material, const MaterialTextureType textureType,
+                                     gfx::TextureHandle& texture, gfx::Sampler& sampler,
+                                     gfx::TextureCreationDesc textureCreationDesc) {
+            const std::string& texturePath = material.texturePaths[enumClassValue(textureType)];
+            if (texturePath.empty())
             {
-                fatalError(std::format("Failed to load texture from path : {}", texturePath));
+                return;
             }
 
-            // determine max mip levels possible.
-
-            textureCreationDesc.mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
+            sampler = getSampler(material, textureType);
 
-            textureCreationDesc.width = static_cast<uint32_t>(width);
-            textureCreationDesc.height = static_cast<uint32_t>(height);
+            if (m_compressTextures)
+            {
+                textureCreationDesc.format = TextureCompressor::getCompressedFormat(textureType);
+            }
 
-            auto texture = graphicsDevice->createTexture(textureCreationDesc, (std::byte*)data);
+            // The deferred geometry pass alpha tests the albedo, so its coverage is preserved in the mip chain.
+            const MipChainSettings mipChainSettings = {
+                .alphaCoverageCutoff = textureType == MaterialTextureType::Albedo ? ALPHA_TEST_CUTOFF : 0.0f,
+            };
 
-            return texture;
+            // The job outlives this lambda, so the parameters are captured by value (texture as a pointer).
+            jobSystem.submit(
+                [&createTexture, texturePath = std::string_view(texturePath), texture = &texture, textureCreationDesc,
+                 mipChainSettings]() { *texture = createTexture(texturePath, textureCreationDesc, mipChainSettings); },
+                &textureCounter);
         };
 
-        size_t index{0};
-        m_materials.resize(model.materials.size());
+        m_materials.resize(materials.size());
 
-        for (const tinygltf::Material& material : model.materials)
+        for (const size_t index : std::views::iota(0u, materials.size()))
+        {
+            const MaterialData& material = materials[index];
+            PBRMaterial& pbrMaterial = m_materials[index];
+
+            loadTexture(material, MaterialTextureType::Albedo, pbrMaterial.albedoTexture,
+                        pbrMaterial.albedoTextureSampler,
+                        gfx::TextureCreationDesc{
+                            .usage = gfx::TextureUsage::TextureFromData,
+                            .format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+                            .name = m_modelName + L" albedo texture",
+                        });
+
+            loadTexture(material, MaterialTextureType::MetalRoughness, pbrMaterial.metalRoughnessTexture,
+                        pbrMaterial.metalRoughnessTextureSampler,
+                        gfx::TextureCreationDesc{
+                            .usage = gfx::TextureUsage::TextureFromData,
+                            .format = DXGI_FORMAT_R8G8B8A8_UNORM,
+                            .name = m_modelName + L" metal roughness texture",
+                        });
+
+            loadTexture(material, MaterialTextureType::Normal, pbrMaterial.normalTexture,
+                        pbrMaterial.normalTextureSampler,
+                        gfx::TextureCreationDesc{
+                            .usage = gfx::TextureUsage::TextureFromData,
+                            .format = DXGI_FORMAT_R8G8B8A8_UNORM,
+                            .name = m_modelName + L" normal texture",
+                        });
+
+            loadTexture(material, MaterialTextureType::AO, pbrMaterial.aoTexture, pbrMaterial.aoTextureSampler,
+                        gfx::TextureCreationDesc{
+                            .usage = gfx::TextureUsage::TextureFromData,
+                            .format = DXGI_FORMAT_R8G8B8A8_UNORM,
+                            .name = m_modelName + L" occlusion texture",
+                        });
+
+            loadTexture(material, MaterialTextureType::Emissive, pbrMaterial.emissiveTexture,
+                        pbrMaterial.emissiveTextureSampler,
+                        gfx::TextureCreationDesc{
+                            .usage = gfx::TextureUsage::TextureFromData,
+                            .format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+                            .name = m_modelName + L" emissive texture",
+                        });
+        }
+
+        jobSystem.wait(textureCounter);
+
+        if (!m_materialTable)
+        {
+            return;
+        }
+
+        // The material data holds the SRV indices of the textures, so it is added once all textures have been created.
+        for (const size_t index : std::views::iota(0u, materials.size()))
         {
-            PBRMaterial pbrMaterial{};
-
-            {
-                const std::jthread albedoTextureThread([&]() {
-                    if (material.pbrMetallicRoughness.baseColorTexture.index >= 0)
-                    {
-                        const tinygltf::Texture& albedoTexture =
-                            model.textures[material.pbrMetallicRoughness.baseColorTexture.index];
-                        const tinygltf::Image& albedoImage = model.images[albedoTexture.source];
-
-                        pbrMaterial.albedoTexture =
-                            createTexture(albedoImage, gfx::TextureCreationDesc{
-                                                           .usage = gfx::TextureUsage::TextureFromData,
-                                                           .format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-                                                           .mipLevels = 6u,
-                                                           .name = m_modelName + L" albedo texture",
-                                                       });
-                        pbrMaterial.albedoTextureSampler = m_samplers[albedoTexture.sampler];
-                    }
-                });
-
-                const std::jthread metalRoughnessThread([&]() {
-                    if (material.pbrMetallicRoughness.metallicRoughnessTexture.index >= 0)
-                    {
-
-                        const tinygltf::Texture& metalRoughnessTexture =
-                            model.textures[material.pbrMetallicRoughness.metallicRoughnessTexture.index];
-                        const tinygltf::Image& metalRoughnessImage = model.images[metalRoughnessTexture.source];
-
-                        pbrMaterial.metalRoughnessTexture =
-                            createTexture(metalRoughnessImage, gfx::TextureCreationDesc{
-                                                                   .usage = gfx::TextureUsage::TextureFromData,
-                                                                   .format = DXGI_FORMAT_R8G8B8A8_UNORM,
-                                                                   .mipLevels = 4u,
-                                                                   .name = m_modelName + L" metal roughness texture",
-                                                               });
-                        pbrMaterial.metalRoughnessTextureSampler = m_samplers[metalRoughnessTexture.sampler];
-                    }
-                });
-
-                const std::jthread normalTextureThread([&]() {
-                    if (material.normalTexture.index >= 0)
-                    {
-
-                        const tinygltf::Texture& normalTexture = model.textures[material.normalTexture.index];
-                        const tinygltf::Image& normalImage = model.images[normalTexture.source];
-
-                        pbrMaterial.normalTexture =
-                            createTexture(normalImage, gfx::TextureCreationDesc{
-                                                           .usage = gfx::TextureUsage::TextureFromData,
-                                                           .format = DXGI_FORMAT_R8G8B8A8_UNORM,
-                                                           .mipLevels = 2u,
-                                                           .name = m_modelName + L" normal texture",
-                                                       });
-
-                        pbrMaterial.normalTextureSampler = m_samplers[normalTexture.sampler];
-                    }
-                });
-
-                const std::jthread occlusionTextureThead([&]() {
-                    if (material.occlusionTexture.index >= 0)
-                    {
-
-                        const tinygltf::Texture& aoTexture = model.textures[material.occlusionTexture.index];
-                        const tinygltf::Image& aoImage = model.images[aoTexture.source];
-
-                        pbrMaterial.aoTexture = createTexture(aoImage, gfx::TextureCreationDesc{
-                                                                           .usage = gfx::TextureUsage::TextureFromData,
-                                                                           .format = DXGI_FORMAT_R8G8B8A8_UNORM,
-                                                                           .mipLevels = 4u,
-                                                                           .name = m_modelName + L" occlusion texture",
-                                                                       });
-                        pbrMaterial.aoTextureSampler = m_samplers[aoTexture.sampler];
-                    }
-                });
-
-                const std::jthread emissiveTextureThead([&]() {
-                    if (material.emissiveTexture.index >= 0)
-                    {
-
-                        const tinygltf::Texture& emissiveTexture = model.textures[material.emissiveTexture.index];
-                        const tinygltf::Image& emissiveImage = model.images[emissiveTexture.source];
-
-                        pbrMaterial.emissiveTexture =
-                            createTexture(emissiveImage, gfx::TextureCreationDesc{
-                                                             .usage = gfx::TextureUsage::TextureFromData,
-                                                             .format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-                                                             .mipLevels = 4u,
-                                                             .name = m_modelName + L" emissive texture",
-                                                         });
-                        pbrMaterial.emissiveTextureSampler = m_samplers[emissiveTexture.sampler];
-                    }
-                });
-            }
-
-            pbrMaterial.materialBuffer = graphicsDevice->createBuffer<interlop::MaterialBuffer>(gfx::BufferCreationDesc{
+            const math::XMFLOAT4& baseColorFactor = materials[index].baseColorFactor;
+
+            interlop::MaterialData materialData = {
+                .roughnessFactor = 1.0f,
+                .metallicFactor = 1.0f,
+                .emissiveFactor = 0.0f,
+                .albedoColor = math::XMFLOAT3(baseColorFactor.x, baseColorFactor.y, baseColorFactor.z),
+            };
+            setMaterialTextureIndices(graphicsDevice->getTexturePool(), m_materials[index], materialData);
+
+            m_materials[index].materialIndex = m_materialTable->addMaterial(materialData);
+        }
+    }
+
+    void Model::loadMeshes(const gfx::GraphicsDevice* const graphicsDevice, std::span<const MeshView> meshes)
+    {
+        // One job per mesh : the vertex streams of all meshes are encoded and uploaded in parallel.
+        const auto loadMesh = [&](const uint32_t i) {
+            const MeshView& meshView = meshes[i];
+
+            Mesh mesh{};
+
+            const std::wstring meshName = m_modelName + L" Mesh " + std::to_wstring(i);
+
+            const gfx::BufferCreationDesc positionBufferCreationDesc = {
+                .usage = gfx::BufferUsage::StructuredBuffer,
+                .name = meshName + L" position buffer",
+            };
+
+            const gfx::BufferCreationDesc textureCoordBufferCreationDesc = {
+                .usage = gfx::BufferUsage::StructuredBuffer,
+                .name = meshName + L" texture coord buffer",
+            };
+
+            const gfx::BufferCreationDesc normalBufferCreationDesc = {
+                .usage = gfx::BufferUsage::StructuredBuffer,
+                .name = meshName + L" normal buffer",
+            };
+
+            interlop::MeshBuffer meshBufferData{};
+
+            if (m_quantizeVertexStreams)
+            {
+                mesh.positionBuffer = graphicsDevice->createBuffer<QuantizedPosition>(
+                    positionBufferCreationDesc,
+                    VertexQuantization::quantizePositions(meshView.positions, meshView.minBounds, meshView.maxBounds));
+
+                mesh.textureCoordsBuffer = graphicsDevice->createBuffer<uint32_t>(
+                    textureCoordBufferCreationDesc,
+                    VertexQuantization::encodeHalfTextureCoords(meshView.textureCoords));
+
+                mesh.normalBuffer = graphicsDevice->createBuffer<uint32_t>(
+                    normalBufferCreationDesc, VertexQuantization::encodeOctahedralNormals(meshView.normals));
+
+                meshBufferData = {
+                    .positionMin = meshView.minBounds,
+                    .isQuantized = 1u,
+                    .positionExtent = math::XMFLOAT3(meshView.maxBounds.x - meshView.minBounds.x,
+                                                     meshView.maxBounds.y - meshView.minBounds.y,
+                                                     meshView.maxBounds.z - meshView.minBounds.z),
+                };
+            }
+            else
+            {
+                mesh.positionBuffer =
+                    graphicsDevice->createBuffer<math::XMFLOAT3>(positionBufferCreationDesc, meshView.positions);
+
+                mesh.textureCoordsBuffer = graphicsDevice->createBuffer<math::XMFLOAT2>(
+                    textureCoordBufferCreationDesc, meshView.textureCoords);
+
+                mesh.normalBuffer =
+                    graphicsDevice->createBuffer<math::XMFLOAT3>(normalBufferCreationDesc, meshView.normals);
+            }
+
+            mesh.meshBuffer = graphicsDevice->createBuffer<interlop::MeshBuffer>(gfx::BufferCreationDesc{
                 .usage = gfx::BufferUsage::ConstantBuffer,
-                .name = m_modelName + L"_MaterialBuffer" + std::to_wstring(index),
+                .name = meshName + L" mesh buffer",
             });
 
-            pbrMaterial.materialBufferData.roughnessFactor = 1.0f;
-            pbrMaterial.materialBufferData.metallicFactor = 1.0f;
-            pbrMaterial.materialBufferData.emissiveFactor = 0.0f,
-            pbrMaterial.materialBufferData.albedoColor = math::XMFLOAT3(
-                material.pbrMetallicRoughness.baseColorFactor[0], material.pbrMetallicRoughness.baseColorFactor[1],
-                material.pbrMetallicRoughness.baseColorFactor[2]);
+            mesh.meshBuffer.update(&meshBufferData);
+
+            const gfx::BufferCreationDesc indexBufferCreationDesc = {
+                .usage = gfx::BufferUsage::StructuredBuffer,
+                .name = meshName + L" index buffer",
+            };
+
+            mesh.indicesCount = static_cast<uint32_t>(meshView.indices.size() / meshView.indexStride);
+
+            if (meshView.indexStride == sizeof(uint32_t))
+            {
+                mesh.indexBuffer = graphicsDevice->createBuffer<uint32_t>(
+                    indexBufferCreationDesc,
+                    std::span(reinterpret_cast<const uint32_t*>(meshView.indices.data()), mesh.indicesCount));
+            }
+            else
+            {
+                mesh.indexBuffer = graphicsDevice->createBuffer<uint16_t>(
+                    indexBufferCreationDesc,
+                    std::span(reinterpret_cast<const uint16_t*>(meshView.indices.data()), mesh.indicesCount));
+            }
+
+            if (!meshView.lods.empty())
+            {
+                const gfx::BufferCreationDesc lodIndexBufferCreationDesc = {
+                    .usage = gfx::BufferUsage::StructuredBuffer,
+                    .name = meshName + L" LOD index buffer",
+                };
+
+                const size_t lodIndexCount = meshView.lodIndices.size() / meshView.indexStride;
+
+                if (meshView.indexStride == sizeof(uint32_t))
+                {
+                    mesh.lodIndexBuffer = graphicsDevice->createBuffer<uint32_t>(
+                        lodIndexBufferCreationDesc,
+                        std::span(reinterpret_cast<const uint32_t*>(meshView.lodIndices.data()), lodIndexCount));
+                }
+                else
+                {
+                    mesh.lodIndexBuffer = graphicsDevice->createBuffer<uint16_t>(
+                        lodIndexBufferCreationDesc,
+                        std::span(reinterpret_cast<const uint16_t*>(meshView.lodIndices.data()), lodIndexCount));
+                }
+
+                mesh.lods.assign(meshView.lods.begin(), meshView.lods.end());
+            }
+
+            if (m_streamTextures)
+            {
+                mesh.textureCoordDensity = computeTextureCoordDensity(meshView);
+            }
+
+            // The bounding sphere is derived from the AABB, which is good enough for LOD selection.
+            const math::XMVECTOR minBounds = math::XMLoadFloat3(&meshView.minBounds);
+            const math::XMVECTOR maxBounds = math::XMLoadFloat3(&meshView.maxBounds);
+
+            math::XMStoreFloat3(&mesh.boundingSphereCenter,
+                                math::XMVectorScale(math::XMVectorAdd(minBounds, maxBounds), 0.5f));
+            mesh.boundingSphereRadius =
+                math::XMVectorGetX(math::XMVector3Length(math::XMVectorSubtract(maxBounds, minBounds))) * 0.5f;
+
+            if (!meshView.meshlets.meshlets.empty())
+            {
+                const auto getMeshletBufferCreationDesc = [&](const std::wstring_view bufferName) {
+                    return gfx::BufferCreationDesc{
+                        .usage = gfx::BufferUsage::StructuredBuffer,
+                        .name = meshName + L" " + std::wstring(bufferName),
+                    };
+                };
+
+                mesh.meshlets = MeshletBuffers{
+                    .meshletBuffer = graphicsDevice->createBuffer<Meshlet>(
+                        getMeshletBufferCreationDesc(L"meshlet buffer"), meshView.meshlets.meshlets),
+                    .meshletBoundsBuffer = graphicsDevice->createBuffer<MeshletBounds>(
+                        getMeshletBufferCreationDesc(L"meshlet bounds buffer"), meshView.meshlets.bounds),
+                    .meshletVertexBuffer = graphicsDevice->createBuffer<uint32_t>(
+                        getMeshletBufferCreationDesc(L"meshlet vertex buffer"), meshView.meshlets.vertices),
+                    .meshletTriangleBuffer = graphicsDevice->createBuffer<uint32_t>(
+                        getMeshletBufferCreationDesc(L"meshlet triangle buffer"), meshView.meshlets.triangles),
+                    .meshletCount = static_cast<uint32_t>(meshView.meshlets.meshlets.size()),
+                };
+            }
+
+            mesh.materialIndex = meshView.materialIndex;
+
+            m_meshes[i] = std::move(mesh);
+        };
+
+        m_meshes.resize(meshes.size());
+
+        core::JobSystem& jobSystem = core::JobSystem::get();
+        core::JobCounter meshCounter{};
 
-            pbrMaterial.materialIndex = index;
-            m_materials[index++] = std::move(pbrMaterial);
-        } // namespace helios::scene
+        jobSystem.dispatch(static_cast<uint32_t>(meshes.size()), 1u, loadMesh, &meshCounter);
+        jobSystem.wait(meshCounter);
     }
 } // namespace helios::scene
@@ -12,25 +12,28 @@ namespace helios::scene
 {
     Scene::Scene(const gfx::GraphicsDevice* const graphicsDevice)
     {
-        // Create scene buffer.
-        m_sceneBuffer = graphicsDevice->createBuffer<interlop::SceneBuffer>(gfx::BufferCreationDesc{
-            .usage = gfx::BufferUsage::ConstantBuffer,
-            .name = L"Scene Buffer",
-        });
-
         m_lights = Lights(graphicsDevice);
+        m_transformStore = std::make_unique<TransformStore>(graphicsDevice);
+        m_materialTable = std::make_unique<MaterialTable>(graphicsDevice);
     }
 
     void Scene::addModel(const gfx::GraphicsDevice* const graphicsDevice, const ModelCreationDesc& modelCreationDesc)
     {
         const std::wstring modelName{modelCreationDesc.modelName};
+        const std::wstring modelPath{modelCreationDesc.modelPath};
+
+        TransformStore* const transformStore = m_transformStore.get();
+        MaterialTable* const materialTable = m_materialTable.get();
 
-        m_modelFutures[modelName] = std::async(
-            std::launch::async,
-            [&](const gfx::GraphicsDevice* const graphicsDevice, const scene::ModelCreationDesc& modelCreationDesc) {
-                return std::make_unique<scene::Model>(graphicsDevice, modelCreationDesc);
-            },
-            graphicsDevice, modelCreationDesc);
+        // The model is loaded after this function returns, so the strings viewed by the creation desc are copied.
+        m_modelFutures[modelName] = std::async(std::launch::async, [=]() {
+            ModelCreationDesc ownedModelCreationDesc = modelCreationDesc;
+            ownedModelCreationDesc.modelPath = modelPath;
+            ownedModelCreationDesc.modelName = modelName;
+
+            return std::make_unique<scene::Model>(graphicsDevice, ownedModelCreationDesc, transformStore,
+                                                   materialTable);
+        });
     }
 
     void Scene::addLight(const gfx::GraphicsDevice* device, const LightCreationDesc& lightCreationDesc)
@@ -78,13 +81,59 @@ namespace helios::scene
             m_models[name] = std::move(modelFuture.get());
         }
 
+        for (auto& [name, model] : m_loadedModels)
+        {
+            m_models[name] = std::move(model);
+        }
+
+        // The materials of the new models are made valid now, so that their texture indices can be updated before the
+        // material table is written (see streamTextures and updateMaterials).
+        m_materialTable->addPendingMaterials();
+        m_hasNewModels = true;
+
         m_modelFutures.clear();
+        m_loadedModels.clear();
     }
 
-    void Scene::update(const float deltaTime, const core::Input& input, const float aspectRatio)
+    void Scene::pollResourceLoading(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        std::erase_if(m_modelFutures, [&](auto& modelFuture) {
+            if (modelFuture.second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return false;
+            }
+
+            m_loadedModels[modelFuture.first] = modelFuture.second.get();
+            return true;
+        });
+
+        // Models are only rendered once their uploads have completed, so the direct queue never waits for them.
+        std::erase_if(m_loadedModels, [&](auto& loadedModel) {
+            if (!graphicsDevice->isUploadComplete(loadedModel.second->getUploadTicket()))
+            {
+                return false;
+            }
+
+            m_models[loadedModel.first] = std::move(loadedModel.second);
+            m_hasNewModels = true;
+
+            return true;
+        });
+
+        if (m_hasNewModels)
+        {
+            m_materialTable->addPendingMaterials();
+        }
+    }
+
+    void Scene::update(const gfx::GraphicsDevice* const graphicsDevice, const float deltaTime,
+                       const core::Input& input, const uint32_t viewportWidth, const uint32_t viewportHeight)
     {
         m_camera.update(deltaTime, input);
 
+        m_viewportHeight = viewportHeight;
+        const float aspectRatio = static_cast<float>(viewportWidth) / static_cast<float>(viewportHeight);
+
         const interlop::SceneBuffer sceneBufferData = {
             .viewProjectionMatrix =
                 m_camera.computeAndGetViewMatrix() *
@@ -98,15 +147,56 @@ namespace helios::scene
             .inverseViewMatrix = math::XMMatrixInverse(nullptr, m_camera.computeAndGetViewMatrix()),
         };
 
-        m_sceneBuffer.update(&sceneBufferData);
+        m_sceneBuffer = graphicsDevice->allocateFrameConstants(sceneBufferData);
 
-        for (auto& [name, model] : m_models)
+        m_transformStore->update(graphicsDevice);
+
+        m_lights->update(graphicsDevice, sceneBufferData.viewMatrix);
+    }
+
+    void Scene::streamTextures(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        gfx::TextureStreamer* const textureStreamer = graphicsDevice->getTextureStreamer();
+
+        const LodSelectionDesc lodSelectionDesc = getCameraLodSelectionDesc();
+
+        for (const auto& [name, model] : m_models)
         {
-            model->getTransformComponent().update();
-            model->updateMaterialBuffer();
+            model->requestTextureMips(textureStreamer, lodSelectionDesc);
         }
 
-        m_lights->update(sceneBufferData.viewMatrix);
+        textureStreamer->update();
+
+        // The material table holds the SRV indices of the material textures, so they are updated once the streamer has
+        // changed them. The indices of models that were added since the last frame are updated as well, as they are
+        // copied into the table when the model is created (and its textures may have been streamed since).
+        if (m_hasNewModels || textureStreamer->getResidencyChangeCount() != m_textureResidencyChangeCount)
+        {
+            m_hasNewModels = false;
+            m_textureResidencyChangeCount = textureStreamer->getResidencyChangeCount();
+
+            for (const auto& [name, model] : m_models)
+            {
+                model->updateMaterialTextureIndices();
+            }
+        }
+    }
+
+    void Scene::updateMaterials(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        m_materialTable->update(graphicsDevice);
+    }
+
+    LodSelectionDesc Scene::getCameraLodSelectionDesc() const
+    {
+        return LodSelectionDesc{
+            .viewPosition = math::XMFLOAT3(m_camera.m_cameraPosition.x, m_camera.m_cameraPosition.y,
+                                           m_camera.m_cameraPosition.z),
+            .projectionScale = static_cast<float>(m_viewportHeight) /
+                               (2.0f * std::tan(math::XMConvertToRadians(m_fov) * 0.5f)),
+            .isOrthographic = false,
+            .errorThreshold = m_lodErrorThreshold,
+        };
     }
 
     void Scene::renderModels(const gfx::GraphicsContext* const graphicsContext)
@@ -148,22 +238,32 @@ namespace helios::scene
     {
         interlop::DeferredGPassRenderResources deferredGPassenderResources = {
             .sceneBufferIndex = m_sceneBuffer.cbvIndex,
+            .materialTableIndex = m_materialTable->getSrvIndex(),
         };
 
+        const LodSelectionDesc lodSelectionDesc = getCameraLodSelectionDesc();
+
         for (const auto& [name, model] : m_models)
         {
-            model->render(graphicsContext, deferredGPassenderResources);
+            model->render(graphicsContext, deferredGPassenderResources, lodSelectionDesc);
         }
     }
 
     void Scene::renderModels(const gfx::GraphicsContext* const graphicsContext,
-                             const interlop::ShadowPassRenderResources& renderResources)
+                             const interlop::ShadowPassRenderResources& renderResources,
+                             const float shadowMapTexelsPerUnit)
     {
         interlop::ShadowPassRenderResources shadowPassRenderResources = renderResources;
 
+        const LodSelectionDesc lodSelectionDesc = {
+            .projectionScale = shadowMapTexelsPerUnit,
+            .isOrthographic = true,
+            .errorThreshold = m_shadowLodErrorThreshold,
+        };
+
         for (const auto& [name, model] : m_models)
         {
-            model->render(graphicsContext, shadowPassRenderResources);
+            model->render(graphicsContext, shadowPassRenderResources, lodSelectionDesc);
         }
     }
     void Scene::renderLights(const gfx::GraphicsContext* const graphicsContext)
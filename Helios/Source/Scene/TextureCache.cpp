@@ -0,0 +1,212 @@
+#include "Scene/TextureCache.hpp"
+
+#include "Core/ImageDecoder.hpp"
+#include "Graphics/DDSFile.hpp"
+#include "Graphics/GraphicsDevice.hpp"
+#include "Scene/TextureCompressor.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        // Cooked textures are stored next to the source image, with the format and mip chain settings in the file name
+        // (as the same image can be cooked with different settings).
+        std::wstring getCookedTexturePath(const std::string_view texturePath, const DXGI_FORMAT format,
+                                          const MipChainSettings& mipChainSettings)
+        {
+            std::filesystem::path cookedTexturePath{texturePath};
+            cookedTexturePath.replace_extension(
+                std::format(".format{}.filter{}.coverage{}.dds", static_cast<uint32_t>(format),
+                            enumClassValue(mipChainSettings.filter),
+                            static_cast<uint32_t>(std::round(mipChainSettings.alphaCoverageCutoff * 100.0f))));
+
+            return cookedTexturePath.wstring();
+        }
+
+        // A cooked texture is out of date if it was produced by a different cook version or is older than the source
+        // image.
+        bool isCookedTextureValid(const std::string_view texturePath, const std::wstring_view cookedTexturePath)
+        {
+            const std::optional<gfx::DDSFile> ddsFile = gfx::DDSFile::open(cookedTexturePath);
+            if (!ddsFile.has_value() || ddsFile->getTextureDesc().cookVersion != TextureCache::TEXTURE_COOK_VERSION)
+            {
+                return false;
+            }
+
+            std::error_code sourceErrorCode{};
+            std::error_code cookedErrorCode{};
+
+            const auto sourceWriteTime = std::filesystem::last_write_time(texturePath, sourceErrorCode);
+            const auto cookedWriteTime = std::filesystem::last_write_time(cookedTexturePath, cookedErrorCode);
+
+            return !sourceErrorCode && !cookedErrorCode && cookedWriteTime >= sourceWriteTime;
+        }
+
+        // Decodes the image, generates its mip chain (see MipChainBuilder) and writes all mip levels into a DDS file.
+        // Block compressed formats are compressed by the TextureCompressor. Images that can not be block compressed
+        // (the dimensions of mip 0 must be a multiple of 4) are stored uncompressed.
+        void cookTexture(const std::string_view texturePath, const std::wstring_view cookedTexturePath,
+                         const DXGI_FORMAT format, const MipChainSettings& mipChainSettings)
+        {
+            const core::DecodedImage decodedImage = core::ImageDecoder::get().decode(texturePath);
+
+            const uint32_t width = decodedImage.getWidth();
+            const uint32_t height = decodedImage.getHeight();
+
+            const bool isSRGB = gfx::Texture::isTextureSRGB(format);
+
+            DXGI_FORMAT cookedFormat = format;
+            if (gfx::Texture::isBlockCompressed(format) && (width % 4u != 0u || height % 4u != 0u))
+            {
+                cookedFormat = isSRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+            }
+
+            const std::span<const uint8_t> pixels(reinterpret_cast<const uint8_t*>(decodedImage.getData()),
+                                                  decodedImage.getSizeInBytes());
+
+            const std::vector<MipLevel> mipLevels =
+                MipChainBuilder::buildMipChain(pixels, width, height, isSRGB, mipChainSettings);
+
+            std::vector<std::byte> textureData{};
+
+            const auto appendMipLevel = [&](std::span<const uint8_t> mipPixels, const uint32_t mipWidth,
+                                            const uint32_t mipHeight) {
+                if (gfx::Texture::isBlockCompressed(cookedFormat))
+                {
+                    const std::vector<std::byte> compressedMip =
+                        TextureCompressor::compress(cookedFormat, mipPixels, mipWidth, mipHeight);
+                    textureData.insert(textureData.end(), compressedMip.begin(), compressedMip.end());
+                }
+                else
+                {
+                    const std::span<const std::byte> mipBytes = std::as_bytes(mipPixels);
+                    textureData.insert(textureData.end(), mipBytes.begin(), mipBytes.end());
+                }
+            };
+
+            appendMipLevel(pixels, width, height);
+            for (const MipLevel& mipLevel : mipLevels)
+            {
+                appendMipLevel(mipLevel.pixels, mipLevel.width, mipLevel.height);
+            }
+
+            gfx::DDSFile::write(cookedTexturePath,
+                                gfx::DDSTextureDesc{
+                                    .format = cookedFormat,
+                                    .width = width,
+                                    .height = height,
+                                    .mipLevels = static_cast<uint32_t>(mipLevels.size()) + 1u,
+                                    .cookVersion = TextureCache::TEXTURE_COOK_VERSION,
+                                },
+                                textureData);
+        }
+    } // namespace
+
+    TextureCache& TextureCache::get()
+    {
+        static TextureCache textureCache{};
+
+        return textureCache;
+    }
+
+    gfx::TextureHandle TextureCache::getTexture(const gfx::GraphicsDevice* const graphicsDevice,
+                                                const std::string_view texturePath,
+                                                const gfx::TextureCreationDesc& textureCreationDesc,
+                                                const MipChainSettings& mipChainSettings, const bool streamMips)
+    {
+        // Normalize the path, so that different relative paths (or separators) to the same image share an entry.
+        const std::string key =
+            std::format("{}|{}|{}|{}|{}", std::filesystem::path(texturePath).lexically_normal().generic_string(),
+                        static_cast<uint32_t>(textureCreationDesc.format), enumClassValue(mipChainSettings.filter),
+                        mipChainSettings.alphaCoverageCutoff, streamMips);
+
+        std::shared_ptr<CacheEntry> entry{};
+
+        {
+            const std::scoped_lock lock(m_entriesMutex);
+
+            std::shared_ptr<CacheEntry>& cacheEntry = m_entries[key];
+            if (!cacheEntry)
+            {
+                cacheEntry = std::make_shared<CacheEntry>();
+            }
+
+            entry = cacheEntry;
+        }
+
+        const std::scoped_lock lock(entry->mutex);
+
+        // Fails if the last reference to the texture has been removed since it was loaded.
+        if (graphicsDevice->getTexturePool()->tryAddReference(entry->texture))
+        {
+            return entry->texture;
+        }
+
+        entry->texture = loadTexture(graphicsDevice, texturePath, textureCreationDesc, mipChainSettings, streamMips);
+
+        return entry->texture;
+    }
+
+    gfx::TextureHandle TextureCache::loadTexture(const gfx::GraphicsDevice* const graphicsDevice,
+                                                 const std::string_view texturePath,
+                                                 const gfx::TextureCreationDesc& paramTextureCreationDesc,
+                                                 const MipChainSettings& mipChainSettings, const bool streamMips)
+    {
+        gfx::TexturePool* const texturePool = graphicsDevice->getTexturePool();
+
+        gfx::TextureCreationDesc textureCreationDesc = paramTextureCreationDesc;
+
+        // Textures are loaded from the cooked DDS file (with all mip levels), which is (re)created if it is missing or
+        // out of date.
+        const std::wstring cookedTexturePath =
+            getCookedTexturePath(texturePath, textureCreationDesc.format, mipChainSettings);
+
+        if (!isCookedTextureValid(texturePath, cookedTexturePath))
+        {
+            cookTexture(texturePath, cookedTexturePath, textureCreationDesc.format, mipChainSettings);
+        }
+
+        // The DDS file may fail to be written (for example, if the model directory is read only).
+        if (isCookedTextureValid(texturePath, cookedTexturePath))
+        {
+            textureCreationDesc.usage = gfx::TextureUsage::TextureFromContainer;
+            textureCreationDesc.path = cookedTexturePath;
+
+            if (!streamMips)
+            {
+                return texturePool->add(graphicsDevice->createTexture(textureCreationDesc));
+            }
+
+            // Only the tail of the mip chain is loaded, the other mips are streamed in once they are requested.
+            const gfx::DDSTextureDesc ddsTextureDesc = gfx::DDSFile::open(cookedTexturePath)->getTextureDesc();
+            textureCreationDesc.mostDetailedMip = gfx::TextureStreamer::getTailMip(ddsTextureDesc);
+
+            const gfx::TextureHandle texture = texturePool->add(graphicsDevice->createTexture(textureCreationDesc));
+
+            graphicsDevice->getTextureStreamer()->registerTexture(texture, cookedTexturePath, ddsTextureDesc,
+                                                                  textureCreationDesc.name);
+
+            return texture;
+        }
+
+        log(std::format(L"Failed to cook texture {}, loading it uncompressed.", stringToWString(texturePath)));
+
+        textureCreationDesc.format = gfx::Texture::isTextureSRGB(textureCreationDesc.format)
+                                         ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+                                         : DXGI_FORMAT_R8G8B8A8_UNORM;
+
+        // The decoded image is released (and its staging memory returned to the decoder) once the texture is uploaded.
+        const core::DecodedImage decodedImage = core::ImageDecoder::get().decode(texturePath);
+
+        const uint32_t width = decodedImage.getWidth();
+        const uint32_t height = decodedImage.getHeight();
+
+        // determine max mip levels possible.
+        textureCreationDesc.mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
+
+        textureCreationDesc.width = width;
+        textureCreationDesc.height = height;
+
+        return texturePool->add(graphicsDevice->createTexture(textureCreationDesc, decodedImage.getData()));
+    }
+} // namespace helios::scene
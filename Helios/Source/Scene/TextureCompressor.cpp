@@ -0,0 +1,619 @@
+#include "Scene/TextureCompressor.hpp"
+
+#include "Graphics/Resources.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        constexpr uint32_t BLOCK_PIXEL_COUNT = 16u;
+
+        // Pixels of a 4x4 block (in row order), with each component in the [0, 255] range.
+        using BlockPixels = std::array<math::XMVECTOR, BLOCK_PIXEL_COUNT>;
+        using BlockValues = std::array<float, BLOCK_PIXEL_COUNT>;
+        using BlockIndices = std::array<uint8_t, BLOCK_PIXEL_COUNT>;
+
+        // Pixels outside of the image (for images whose dimensions are not a multiple of 4) are clamped to the edge.
+        BlockPixels loadBlock(std::span<const uint8_t> pixels, const uint32_t width, const uint32_t height,
+                              const uint32_t blockX, const uint32_t blockY)
+        {
+            BlockPixels block{};
+
+            for (const uint32_t y : std::views::iota(0u, 4u))
+            {
+                const uint32_t pixelY = std::min(blockY * 4u + y, height - 1u);
+
+                for (const uint32_t x : std::views::iota(0u, 4u))
+                {
+                    const uint32_t pixelX = std::min(blockX * 4u + x, width - 1u);
+                    const uint8_t* const pixel = &pixels[(static_cast<size_t>(pixelY) * width + pixelX) * 4u];
+
+                    block[y * 4u + x] = math::XMVectorSet(static_cast<float>(pixel[0]), static_cast<float>(pixel[1]),
+                                                          static_cast<float>(pixel[2]), static_cast<float>(pixel[3]));
+                }
+            }
+
+            return block;
+        }
+
+        BlockValues getBlockComponent(const BlockPixels& block, const uint32_t component)
+        {
+            BlockValues values{};
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                values[i] = math::XMVectorGetByIndex(block[i], component);
+            }
+
+            return values;
+        }
+
+        math::XMVECTOR clampToByteRange(const math::XMVECTOR value)
+        {
+            return math::XMVectorClamp(value, math::XMVectorZero(), math::XMVectorReplicate(255.0f));
+        }
+
+        // Computes the mean of the block, and the direction along which the pixels vary the most (the principal axis,
+        // found with a few power iterations on the covariance matrix). The axis is zero for single color blocks.
+        void computePrincipalAxis(const BlockPixels& block, math::XMVECTOR& mean, math::XMVECTOR& axis)
+        {
+            mean = math::XMVectorZero();
+            for (const math::XMVECTOR& pixel : block)
+            {
+                mean = math::XMVectorAdd(mean, pixel);
+            }
+            mean = math::XMVectorScale(mean, 1.0f / BLOCK_PIXEL_COUNT);
+
+            std::array<std::array<float, 4>, 4> covariance{};
+            for (const math::XMVECTOR& pixel : block)
+            {
+                math::XMFLOAT4 delta{};
+                math::XMStoreFloat4(&delta, math::XMVectorSubtract(pixel, mean));
+
+                const std::array<float, 4> components = {delta.x, delta.y, delta.z, delta.w};
+                for (const uint32_t i : std::views::iota(0u, 4u))
+                {
+                    for (const uint32_t j : std::views::iota(0u, 4u))
+                    {
+                        covariance[i][j] += components[i] * components[j];
+                    }
+                }
+            }
+
+            // Start from the component with the largest variance.
+            uint32_t largestComponent{};
+            for (const uint32_t i : std::views::iota(1u, 4u))
+            {
+                if (covariance[i][i] > covariance[largestComponent][largestComponent])
+                {
+                    largestComponent = i;
+                }
+            }
+
+            axis = math::XMVectorZero();
+            if (covariance[largestComponent][largestComponent] <= 0.0f)
+            {
+                return;
+            }
+
+            std::array<float, 4> direction{};
+            direction[largestComponent] = 1.0f;
+
+            static constexpr uint32_t POWER_ITERATION_COUNT = 8u;
+            for ([[maybe_unused]] const uint32_t iteration : std::views::iota(0u, POWER_ITERATION_COUNT))
+            {
+                std::array<float, 4> nextDirection{};
+                float largestValue{};
+
+                for (const uint32_t i : std::views::iota(0u, 4u))
+                {
+                    for (const uint32_t j : std::views::iota(0u, 4u))
+                    {
+                        nextDirection[i] += covariance[i][j] * direction[j];
+                    }
+
+                    largestValue = std::max(largestValue, std::abs(nextDirection[i]));
+                }
+
+                if (largestValue <= 0.0f)
+                {
+                    break;
+                }
+
+                for (const uint32_t i : std::views::iota(0u, 4u))
+                {
+                    direction[i] = nextDirection[i] / largestValue;
+                }
+            }
+
+            axis = math::XMVector4Normalize(math::XMVectorSet(direction[0], direction[1], direction[2], direction[3]));
+        }
+
+        // Projects the pixels onto the principal axis, and returns the end points of the range they span.
+        void computeEndPoints(const BlockPixels& block, math::XMVECTOR& endPoint0, math::XMVECTOR& endPoint1)
+        {
+            math::XMVECTOR mean{};
+            math::XMVECTOR axis{};
+            computePrincipalAxis(block, mean, axis);
+
+            float minProjection{std::numeric_limits<float>::max()};
+            float maxProjection{std::numeric_limits<float>::lowest()};
+
+            for (const math::XMVECTOR& pixel : block)
+            {
+                const float projection =
+                    math::XMVectorGetX(math::XMVector4Dot(math::XMVectorSubtract(pixel, mean), axis));
+
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+
+            endPoint0 = clampToByteRange(math::XMVectorAdd(mean, math::XMVectorScale(axis, maxProjection)));
+            endPoint1 = clampToByteRange(math::XMVectorAdd(mean, math::XMVectorScale(axis, minProjection)));
+        }
+
+        // Given the interpolation weight of each pixel (0 : endPoint0, 1 : endPoint1), solves for the end points that
+        // minimize the squared error of the block. Returns false if the system is singular (all weights are equal).
+        bool refineEndPoints(const BlockPixels& block, const BlockValues& weights, math::XMVECTOR& endPoint0,
+                             math::XMVECTOR& endPoint1)
+        {
+            float alpha2{};
+            float alphaBeta{};
+            float beta2{};
+
+            math::XMVECTOR alphaX = math::XMVectorZero();
+            math::XMVECTOR betaX = math::XMVectorZero();
+
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                const float beta = weights[i];
+                const float alpha = 1.0f - beta;
+
+                alpha2 += alpha * alpha;
+                alphaBeta += alpha * beta;
+                beta2 += beta * beta;
+
+                alphaX = math::XMVectorAdd(alphaX, math::XMVectorScale(block[i], alpha));
+                betaX = math::XMVectorAdd(betaX, math::XMVectorScale(block[i], beta));
+            }
+
+            const float determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+            if (std::abs(determinant) < 1e-6f)
+            {
+                return false;
+            }
+
+            const float inverseDeterminant = 1.0f / determinant;
+
+            endPoint0 = clampToByteRange(math::XMVectorScale(
+                math::XMVectorSubtract(math::XMVectorScale(alphaX, beta2), math::XMVectorScale(betaX, alphaBeta)),
+                inverseDeterminant));
+            endPoint1 = clampToByteRange(math::XMVectorScale(
+                math::XMVectorSubtract(math::XMVectorScale(betaX, alpha2), math::XMVectorScale(alphaX, alphaBeta)),
+                inverseDeterminant));
+
+            return true;
+        }
+
+        // Selects the closest palette entry for each pixel, and returns the total squared error of the block.
+        template <size_t PaletteSize>
+        float selectIndices(const BlockPixels& block, const std::array<math::XMVECTOR, PaletteSize>& palette,
+                            BlockIndices& indices)
+        {
+            float totalError{};
+
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                float lowestError{std::numeric_limits<float>::max()};
+
+                for (const uint32_t j : std::views::iota(0u, static_cast<uint32_t>(PaletteSize)))
+                {
+                    const float error =
+                        math::XMVectorGetX(math::XMVector4LengthSq(math::XMVectorSubtract(block[i], palette[j])));
+
+                    if (error < lowestError)
+                    {
+                        lowestError = error;
+                        indices[i] = static_cast<uint8_t>(j);
+                    }
+                }
+
+                totalError += lowestError;
+            }
+
+            return totalError;
+        }
+
+        uint16_t packColor565(const math::XMVECTOR color)
+        {
+            math::XMFLOAT4 value{};
+            math::XMStoreFloat4(&value, color);
+
+            const uint32_t red = static_cast<uint32_t>(std::round(value.x * 31.0f / 255.0f));
+            const uint32_t green = static_cast<uint32_t>(std::round(value.y * 63.0f / 255.0f));
+            const uint32_t blue = static_cast<uint32_t>(std::round(value.z * 31.0f / 255.0f));
+
+            return static_cast<uint16_t>((red << 11u) | (green << 5u) | blue);
+        }
+
+        math::XMVECTOR unpackColor565(const uint16_t color)
+        {
+            const uint32_t red = (color >> 11u) & 31u;
+            const uint32_t green = (color >> 5u) & 63u;
+            const uint32_t blue = color & 31u;
+
+            return math::XMVectorSet(static_cast<float>((red << 3u) | (red >> 2u)),
+                                     static_cast<float>((green << 2u) | (green >> 4u)),
+                                     static_cast<float>((blue << 3u) | (blue >> 2u)), 0.0f);
+        }
+
+        // Encodes the RGB components of the block (the alpha component must be zero). Only the four color mode
+        // (color0 > color1) is used.
+        void encodeBC1Block(const BlockPixels& block, std::byte* const output)
+        {
+            // Interpolation weight (from color0 to color1) of each index.
+            static constexpr std::array<float, 4> INDEX_WEIGHTS = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+            struct BC1Block
+            {
+                uint16_t color0{};
+                uint16_t color1{};
+                BlockIndices indices{};
+            };
+
+            const auto encode = [&](const math::XMVECTOR endPoint0, const math::XMVECTOR endPoint1,
+                                    BC1Block& bc1Block) {
+                bc1Block.color0 = packColor565(endPoint0);
+                bc1Block.color1 = packColor565(endPoint1);
+
+                const math::XMVECTOR color0 = unpackColor565(bc1Block.color0);
+                const math::XMVECTOR color1 = unpackColor565(bc1Block.color1);
+
+                const std::array<math::XMVECTOR, 4> palette = {
+                    color0,
+                    color1,
+                    math::XMVectorLerp(color0, color1, INDEX_WEIGHTS[2]),
+                    math::XMVectorLerp(color0, color1, INDEX_WEIGHTS[3]),
+                };
+
+                return selectIndices(block, palette, bc1Block.indices);
+            };
+
+            math::XMVECTOR endPoint0{};
+            math::XMVECTOR endPoint1{};
+            computeEndPoints(block, endPoint0, endPoint1);
+
+            BC1Block bc1Block{};
+            const float error = encode(endPoint0, endPoint1, bc1Block);
+
+            BlockValues weights{};
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                weights[i] = INDEX_WEIGHTS[bc1Block.indices[i]];
+            }
+
+            if (error > 0.0f && refineEndPoints(block, weights, endPoint0, endPoint1))
+            {
+                BC1Block refinedBC1Block{};
+                if (encode(endPoint0, endPoint1, refinedBC1Block) < error)
+                {
+                    bc1Block = refinedBC1Block;
+                }
+            }
+
+            // color0 <= color1 selects the three color mode, so the colors are swapped (along with the indices).
+            if (bc1Block.color0 < bc1Block.color1)
+            {
+                std::swap(bc1Block.color0, bc1Block.color1);
+                for (uint8_t& index : bc1Block.indices)
+                {
+                    index ^= 1u;
+                }
+            }
+            else if (bc1Block.color0 == bc1Block.color1)
+            {
+                // In three color mode index 3 is black, so all pixels use color0.
+                bc1Block.indices.fill(0u);
+            }
+
+            uint32_t indexBits{};
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                indexBits |= static_cast<uint32_t>(bc1Block.indices[i]) << (i * 2u);
+            }
+
+            std::memcpy(output, &bc1Block.color0, sizeof(uint16_t));
+            std::memcpy(output + 2u, &bc1Block.color1, sizeof(uint16_t));
+            std::memcpy(output + 4u, &indexBits, sizeof(uint32_t));
+        }
+
+        // Encodes a single component using the eight value mode (red0 > red1), with the range of the values as end
+        // points.
+        void encodeBC4Block(const BlockValues& values, std::byte* const output)
+        {
+            const auto [minValue, maxValue] = std::minmax_element(values.begin(), values.end());
+
+            const uint32_t red0 = static_cast<uint32_t>(std::round(*maxValue));
+            const uint32_t red1 = static_cast<uint32_t>(std::round(*minValue));
+
+            std::array<float, 8> palette{};
+            palette[0] = static_cast<float>(red0);
+            palette[1] = static_cast<float>(red1);
+            for (const uint32_t i : std::views::iota(2u, 8u))
+            {
+                palette[i] = static_cast<float>((8u - i) * red0 + (i - 1u) * red1) / 7.0f;
+            }
+
+            uint64_t bits = red0 | (red1 << 8u);
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                uint64_t closestIndex{};
+                for (const uint32_t j : std::views::iota(1u, 8u))
+                {
+                    if (std::abs(values[i] - palette[j]) < std::abs(values[i] - palette[closestIndex]))
+                    {
+                        closestIndex = j;
+                    }
+                }
+
+                bits |= closestIndex << (16u + i * 3u);
+            }
+
+            std::memcpy(output, &bits, sizeof(uint64_t));
+        }
+
+        // Writes values into a 128 bit block, starting from the least significant bit.
+        class BlockBitWriter
+        {
+          public:
+            void write(const uint32_t value, const uint32_t bitCount)
+            {
+                for (const uint32_t bit : std::views::iota(0u, bitCount))
+                {
+                    if ((value >> bit) & 1u)
+                    {
+                        m_bits[m_position / 64u] |= 1ull << (m_position % 64u);
+                    }
+
+                    ++m_position;
+                }
+            }
+
+            void copyTo(std::byte* const output) const
+            {
+                std::memcpy(output, m_bits.data(), sizeof(m_bits));
+            }
+
+          private:
+            std::array<uint64_t, 2> m_bits{};
+            uint32_t m_position{};
+        };
+
+        // Encodes the block using BC7 mode 6 : a single subset, RGBA end points with 7 bits per component and a p bit
+        // (shared lowest bit) per end point, and 4 bit indices.
+        // Reference : https://learn.microsoft.com/en-us/windows/win32/direct3d11/bc7-format-mode-reference.
+        void encodeBC7Block(const BlockPixels& block, std::byte* const output)
+        {
+            static constexpr std::array<uint32_t, 16> INDEX_WEIGHTS = {0u,  4u,  9u,  13u, 17u, 21u, 26u, 30u,
+                                                                       34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u};
+
+            struct Mode6Block
+            {
+                std::array<std::array<uint32_t, 4>, 2> endPoints{};
+                std::array<uint32_t, 2> pBits{};
+                BlockIndices indices{};
+            };
+
+            // Picks the p bit that best reconstructs the end point, returning the reconstructed (8 bit) end point.
+            const auto quantizeEndPoint = [](const math::XMVECTOR endPoint, std::array<uint32_t, 4>& quantized,
+                                             uint32_t& pBit) {
+                math::XMFLOAT4 value{};
+                math::XMStoreFloat4(&value, endPoint);
+                const std::array<float, 4> components = {value.x, value.y, value.z, value.w};
+
+                float lowestError{std::numeric_limits<float>::max()};
+                for (const uint32_t p : std::views::iota(0u, 2u))
+                {
+                    std::array<uint32_t, 4> candidate{};
+                    float error{};
+
+                    for (const uint32_t c : std::views::iota(0u, 4u))
+                    {
+                        candidate[c] = static_cast<uint32_t>(
+                            std::clamp(std::round((components[c] - static_cast<float>(p)) / 2.0f), 0.0f, 127.0f));
+
+                        const float reconstructed = static_cast<float>(candidate[c] * 2u + p);
+                        error += (reconstructed - components[c]) * (reconstructed - components[c]);
+                    }
+
+                    if (error < lowestError)
+                    {
+                        lowestError = error;
+                        quantized = candidate;
+                        pBit = p;
+                    }
+                }
+
+                return std::array<uint32_t, 4>{quantized[0] * 2u + pBit, quantized[1] * 2u + pBit,
+                                               quantized[2] * 2u + pBit, quantized[3] * 2u + pBit};
+            };
+
+            const auto encode = [&](const math::XMVECTOR endPoint0, const math::XMVECTOR endPoint1,
+                                    Mode6Block& mode6Block) {
+                const std::array<uint32_t, 4> color0 =
+                    quantizeEndPoint(endPoint0, mode6Block.endPoints[0], mode6Block.pBits[0]);
+                const std::array<uint32_t, 4> color1 =
+                    quantizeEndPoint(endPoint1, mode6Block.endPoints[1], mode6Block.pBits[1]);
+
+                // Same (integer) interpolation as the hardware decoder.
+                std::array<math::XMVECTOR, 16> palette{};
+                for (const uint32_t i : std::views::iota(0u, 16u))
+                {
+                    const auto interpolate = [&](const uint32_t c) {
+                        return static_cast<float>(
+                            ((64u - INDEX_WEIGHTS[i]) * color0[c] + INDEX_WEIGHTS[i] * color1[c] + 32u) >> 6u);
+                    };
+
+                    palette[i] = math::XMVectorSet(interpolate(0u), interpolate(1u), interpolate(2u), interpolate(3u));
+                }
+
+                return selectIndices(block, palette, mode6Block.indices);
+            };
+
+            math::XMVECTOR endPoint0{};
+            math::XMVECTOR endPoint1{};
+            computeEndPoints(block, endPoint0, endPoint1);
+
+            Mode6Block mode6Block{};
+            const float error = encode(endPoint0, endPoint1, mode6Block);
+
+            BlockValues weights{};
+            for (const uint32_t i : std::views::iota(0u, BLOCK_PIXEL_COUNT))
+            {
+                weights[i] = static_cast<float>(INDEX_WEIGHTS[mode6Block.indices[i]]) / 64.0f;
+            }
+
+            if (error > 0.0f && refineEndPoints(block, weights, endPoint0, endPoint1))
+            {
+                Mode6Block refinedMode6Block{};
+                if (encode(endPoint0, endPoint1, refinedMode6Block) < error)
+                {
+                    mode6Block = refinedMode6Block;
+                }
+            }
+
+            // The most significant bit of the first (anchor) index is implicitly zero, so the end points are swapped
+            // (and the indices inverted) if required.
+            if (mode6Block.indices[0] >= 8u)
+            {
+                std::swap(mode6Block.endPoints[0], mode6Block.endPoints[1]);
+                std::swap(mode6Block.pBits[0], mode6Block.pBits[1]);
+
+                for (uint8_t& index : mode6Block.indices)
+                {
+                    index = static_cast<uint8_t>(15u - index);
+                }
+            }
+
+            BlockBitWriter bitWriter{};
+            bitWriter.write(1u << 6u, 7u);
+
+            for (const uint32_t c : std::views::iota(0u, 4u))
+            {
+                bitWriter.write(mode6Block.endPoints[0][c], 7u);
+                bitWriter.write(mode6Block.endPoints[1][c], 7u);
+            }
+
+            bitWriter.write(mode6Block.pBits[0], 1u);
+            bitWriter.write(mode6Block.pBits[1], 1u);
+
+            bitWriter.write(mode6Block.indices[0], 3u);
+            for (const uint32_t i : std::views::iota(1u, BLOCK_PIXEL_COUNT))
+            {
+                bitWriter.write(mode6Block.indices[i], 4u);
+            }
+
+            bitWriter.copyTo(output);
+        }
+
+        void encodeBlock(const DXGI_FORMAT format, BlockPixels& block, std::byte* const output)
+        {
+            // BC1 and the color block of BC3 only store the RGB components.
+            const auto maskAlpha = [&]() {
+                for (math::XMVECTOR& pixel : block)
+                {
+                    pixel = math::XMVectorSetW(pixel, 0.0f);
+                }
+            };
+
+            switch (format)
+            {
+            case DXGI_FORMAT_BC1_UNORM:
+            case DXGI_FORMAT_BC1_UNORM_SRGB: {
+                maskAlpha();
+                encodeBC1Block(block, output);
+            }
+            break;
+
+            case DXGI_FORMAT_BC3_UNORM:
+            case DXGI_FORMAT_BC3_UNORM_SRGB: {
+                encodeBC4Block(getBlockComponent(block, 3u), output);
+                maskAlpha();
+                encodeBC1Block(block, output + 8u);
+            }
+            break;
+
+            case DXGI_FORMAT_BC4_UNORM: {
+                encodeBC4Block(getBlockComponent(block, 0u), output);
+            }
+            break;
+
+            case DXGI_FORMAT_BC5_UNORM: {
+                encodeBC4Block(getBlockComponent(block, 0u), output);
+                encodeBC4Block(getBlockComponent(block, 1u), output + 8u);
+            }
+            break;
+
+            case DXGI_FORMAT_BC7_UNORM:
+            case DXGI_FORMAT_BC7_UNORM_SRGB: {
+                encodeBC7Block(block, output);
+            }
+            break;
+
+            default: {
+                fatalError("Unsupported format for block compression.");
+            }
+            break;
+            }
+        }
+    } // namespace
+
+    DXGI_FORMAT TextureCompressor::getCompressedFormat(const MaterialTextureType textureType)
+    {
+        switch (textureType)
+        {
+        case MaterialTextureType::Albedo:
+        case MaterialTextureType::Emissive: {
+            return DXGI_FORMAT_BC7_UNORM_SRGB;
+        }
+        break;
+
+        case MaterialTextureType::Normal: {
+            return DXGI_FORMAT_BC5_UNORM;
+        }
+        break;
+
+        case MaterialTextureType::AO: {
+            return DXGI_FORMAT_BC4_UNORM;
+        }
+        break;
+
+        default: {
+            return DXGI_FORMAT_BC7_UNORM;
+        }
+        break;
+        }
+    }
+
+    std::vector<std::byte> TextureCompressor::compress(const DXGI_FORMAT format, std::span<const uint8_t> pixels,
+                                                       const uint32_t width, const uint32_t height)
+    {
+        const uint32_t blockCountX = (width + 3u) / 4u;
+        const uint32_t blockCountY = (height + 3u) / 4u;
+        const uint32_t bytesPerBlock = gfx::Texture::getBytesPerBlock(format);
+
+        std::vector<std::byte> blocks(static_cast<size_t>(blockCountX) * blockCountY * bytesPerBlock);
+
+        for (const uint32_t blockY : std::views::iota(0u, blockCountY))
+        {
+            std::byte* const blockRow = &blocks[static_cast<size_t>(blockY) * blockCountX * bytesPerBlock];
+
+            for (const uint32_t blockX : std::views::iota(0u, blockCountX))
+            {
+                BlockPixels block = loadBlock(pixels, width, height, blockX, blockY);
+                encodeBlock(format, block, blockRow + static_cast<size_t>(blockX) * bytesPerBlock);
+            }
+        }
+
+        return blocks;
+    }
+} // namespace helios::scene
@@ -0,0 +1,212 @@
+#include "Scene/TransformStore.hpp"
+
+#include "Graphics/GraphicsDevice.hpp"
+
+namespace helios::scene
+{
+    namespace
+    {
+        constexpr uint32_t INITIAL_CAPACITY = 64u;
+    } // namespace
+
+    TransformStore::TransformStore(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        m_buffers.resize(gfx::GraphicsDevice::FRAMES_IN_FLIGHT);
+        m_bufferUpdates.resize(gfx::GraphicsDevice::FRAMES_IN_FLIGHT);
+
+        growBuffers(graphicsDevice, INITIAL_CAPACITY);
+    }
+
+    uint32_t TransformStore::addTransform(const TransformCreationDesc& transformCreationDesc)
+    {
+        const std::scoped_lock lock(m_addMutex);
+
+        m_addedTransforms.emplace_back(transformCreationDesc);
+
+        return m_addedTransformCount++;
+    }
+
+    void TransformStore::setRotation(const uint32_t transformIndex, const math::XMFLOAT3& rotation)
+    {
+        m_rotations[transformIndex] = rotation;
+        markDirty(transformIndex);
+    }
+
+    void TransformStore::setScale(const uint32_t transformIndex, const math::XMFLOAT3& scale)
+    {
+        m_scales[transformIndex] = scale;
+        markDirty(transformIndex);
+    }
+
+    void TransformStore::setTranslate(const uint32_t transformIndex, const math::XMFLOAT3& translate)
+    {
+        m_translations[transformIndex] = translate;
+        markDirty(transformIndex);
+    }
+
+    math::XMMATRIX TransformStore::getModelMatrix(const uint32_t transformIndex) const
+    {
+        return math::XMLoadFloat4x4(&m_modelMatrices[transformIndex]);
+    }
+
+    float TransformStore::getMaxScale(const uint32_t transformIndex) const
+    {
+        const math::XMFLOAT3& scale = m_scales[transformIndex];
+
+        // Mirrored transforms have negative scale components.
+        return std::max({std::abs(scale.x), std::abs(scale.y), std::abs(scale.z)});
+    }
+
+    void TransformStore::update(const gfx::GraphicsDevice* const graphicsDevice)
+    {
+        ++m_updateCount;
+
+        {
+            const std::scoped_lock lock(m_addMutex);
+
+            for (const TransformCreationDesc& transformCreationDesc : m_addedTransforms)
+            {
+                m_rotations.emplace_back(transformCreationDesc.rotation);
+                m_scales.emplace_back(transformCreationDesc.scale);
+                m_translations.emplace_back(transformCreationDesc.translate);
+            }
+
+            m_addedTransforms.clear();
+        }
+
+        const uint32_t transformCount = getTransformCount();
+        if (m_modelMatrices.size() != transformCount)
+        {
+            const uint32_t previousTransformCount = static_cast<uint32_t>(m_modelMatrices.size());
+
+            m_modelMatrices.resize(transformCount);
+            m_inverseModelMatrices.resize(transformCount);
+            m_isDirty.resize(transformCount, 0u);
+            m_changeUpdates.resize(transformCount, 0u);
+            m_isPendingWrite.resize(transformCount, 0u);
+
+            for (const uint32_t transformIndex : std::views::iota(previousTransformCount, transformCount))
+            {
+                markDirty(transformIndex);
+            }
+        }
+
+        if (transformCount > m_bufferCapacity)
+        {
+            growBuffers(graphicsDevice, transformCount);
+        }
+
+        // The inverse of scale * rotation * translation is computed from its components, which is cheaper than a
+        // general matrix inverse.
+        for (const uint32_t transformIndex : m_dirtyIndices)
+        {
+            const math::XMVECTOR scale = math::XMLoadFloat3(&m_scales[transformIndex]);
+            const math::XMVECTOR rotation = math::XMLoadFloat3(&m_rotations[transformIndex]);
+            const math::XMVECTOR translation = math::XMLoadFloat3(&m_translations[transformIndex]);
+
+            const math::XMMATRIX rotationMatrix = math::XMMatrixRotationRollPitchYawFromVector(rotation);
+
+            math::XMStoreFloat4x4(&m_modelMatrices[transformIndex],
+                                  math::XMMatrixScalingFromVector(scale) * rotationMatrix *
+                                      math::XMMatrixTranslationFromVector(translation));
+
+            math::XMStoreFloat4x4(&m_inverseModelMatrices[transformIndex],
+                                  math::XMMatrixTranslationFromVector(math::XMVectorNegate(translation)) *
+                                      math::XMMatrixTranspose(rotationMatrix) *
+                                      math::XMMatrixScalingFromVector(math::XMVectorReciprocal(scale)));
+
+            m_isDirty[transformIndex] = 0u;
+            m_changeUpdates[transformIndex] = m_updateCount;
+
+            if (!m_isPendingWrite[transformIndex])
+            {
+                m_isPendingWrite[transformIndex] = 1u;
+                m_pendingWriteIndices.emplace_back(transformIndex);
+            }
+        }
+
+        m_dirtyIndices.clear();
+
+        // The previous frame that used the buffer of the current frame index has completed, so it can be written to.
+        m_currentBufferIndex = graphicsDevice->getCurrentFrameIndex();
+
+        std::byte* const bufferData =
+            static_cast<std::byte*>(m_buffers[m_currentBufferIndex].allocation.mappedPointer.value());
+        const uint64_t inverseModelMatricesOffset = sizeof(math::XMFLOAT4X4) * m_bufferCapacity;
+
+        for (const uint32_t transformIndex : m_pendingWriteIndices)
+        {
+            if (m_changeUpdates[transformIndex] <= m_bufferUpdates[m_currentBufferIndex])
+            {
+                continue;
+            }
+
+            const uint64_t offset = sizeof(math::XMFLOAT4X4) * transformIndex;
+
+            std::memcpy(bufferData + offset, &m_modelMatrices[transformIndex], sizeof(math::XMFLOAT4X4));
+            std::memcpy(bufferData + inverseModelMatricesOffset + offset, &m_inverseModelMatrices[transformIndex],
+                        sizeof(math::XMFLOAT4X4));
+        }
+
+        m_bufferUpdates[m_currentBufferIndex] = m_updateCount;
+
+        // Transforms that have been written to all buffers since they last changed no longer need to be written.
+        const uint64_t oldestBufferUpdate = std::ranges::min(m_bufferUpdates);
+
+        std::erase_if(m_pendingWriteIndices, [&](const uint32_t transformIndex) {
+            if (m_changeUpdates[transformIndex] > oldestBufferUpdate)
+            {
+                return false;
+            }
+
+            m_isPendingWrite[transformIndex] = 0u;
+            return true;
+        });
+    }
+
+    void TransformStore::markDirty(const uint32_t transformIndex)
+    {
+        if (!m_isDirty[transformIndex])
+        {
+            m_isDirty[transformIndex] = 1u;
+            m_dirtyIndices.emplace_back(transformIndex);
+        }
+    }
+
+    void TransformStore::growBuffers(const gfx::GraphicsDevice* const graphicsDevice, const uint32_t transformCount)
+    {
+        m_bufferCapacity = std::max(m_bufferCapacity, INITIAL_CAPACITY);
+        while (m_bufferCapacity < transformCount)
+        {
+            m_bufferCapacity *= 2u;
+        }
+
+        const std::vector<math::XMFLOAT4X4> initialData(m_bufferCapacity * 2u);
+
+        for (const uint32_t i : std::views::iota(0u, static_cast<uint32_t>(m_buffers.size())))
+        {
+            // Frames in flight may still read the previous buffer (and its SRV).
+            graphicsDevice->deferRelease(std::move(m_buffers[i]));
+
+            m_buffers[i] = graphicsDevice->createBuffer<math::XMFLOAT4X4>(
+                gfx::BufferCreationDesc{
+                    .usage = gfx::BufferUsage::DynamicStructuredBuffer,
+                    .name = L"Transform Buffer",
+                },
+                initialData);
+
+            m_bufferUpdates[i] = 0u;
+        }
+
+        for (const uint32_t transformIndex : std::views::iota(0u, getTransformCount()))
+        {
+            m_changeUpdates[transformIndex] = m_updateCount;
+
+            if (!m_isPendingWrite[transformIndex])
+            {
+                m_isPendingWrite[transformIndex] = 1u;
+                m_pendingWriteIndices.emplace_back(transformIndex);
+            }
+        }
+    }
+} // namespace helios::scene
@@ -0,0 +1,106 @@
+#include "Scene/VertexQuantization.hpp"
+
+#include <DirectXPackedVector.h>
+
+namespace helios::scene
+{
+    namespace
+    {
+        uint16_t quantizeUnorm16(const float value)
+        {
+            return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+        }
+
+        uint16_t quantizeSnorm16(const float value)
+        {
+            return static_cast<uint16_t>(static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f)));
+        }
+
+        float signNotZero(const float value)
+        {
+            return value >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        // Returns 1 / extent (or 0 for flat axes, which then always quantize to 0).
+        float getInverseExtent(const float minBound, const float maxBound)
+        {
+            const float extent = maxBound - minBound;
+            return extent > 0.0f ? 1.0f / extent : 0.0f;
+        }
+    } // namespace
+
+    std::vector<QuantizedPosition> VertexQuantization::quantizePositions(std::span<const math::XMFLOAT3> positions,
+                                                                         const math::XMFLOAT3& minBounds,
+                                                                         const math::XMFLOAT3& maxBounds)
+    {
+        const math::XMFLOAT3 inverseExtent = {
+            getInverseExtent(minBounds.x, maxBounds.x),
+            getInverseExtent(minBounds.y, maxBounds.y),
+            getInverseExtent(minBounds.z, maxBounds.z),
+        };
+
+        std::vector<QuantizedPosition> quantizedPositions{};
+        quantizedPositions.reserve(positions.size());
+
+        for (const math::XMFLOAT3& position : positions)
+        {
+            quantizedPositions.emplace_back(QuantizedPosition{
+                .x = quantizeUnorm16((position.x - minBounds.x) * inverseExtent.x),
+                .y = quantizeUnorm16((position.y - minBounds.y) * inverseExtent.y),
+                .z = quantizeUnorm16((position.z - minBounds.z) * inverseExtent.z),
+            });
+        }
+
+        return quantizedPositions;
+    }
+
+    std::vector<uint32_t> VertexQuantization::encodeOctahedralNormals(std::span<const math::XMFLOAT3> normals)
+    {
+        std::vector<uint32_t> encodedNormals{};
+        encodedNormals.reserve(normals.size());
+
+        for (const math::XMFLOAT3& normal : normals)
+        {
+            // Project onto the octahedron (L1 norm = 1), and fold the lower hemisphere over the diagonals.
+            const float l1Norm = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+            if (l1Norm == 0.0f)
+            {
+                encodedNormals.emplace_back(0u);
+                continue;
+            }
+
+            float x = normal.x / l1Norm;
+            float y = normal.y / l1Norm;
+
+            if (normal.z < 0.0f)
+            {
+                const float foldedX = (1.0f - std::abs(y)) * signNotZero(x);
+                const float foldedY = (1.0f - std::abs(x)) * signNotZero(y);
+
+                x = foldedX;
+                y = foldedY;
+            }
+
+            encodedNormals.emplace_back(static_cast<uint32_t>(quantizeSnorm16(x)) |
+                                        (static_cast<uint32_t>(quantizeSnorm16(y)) << 16u));
+        }
+
+        return encodedNormals;
+    }
+
+    std::vector<uint32_t> VertexQuantization::encodeHalfTextureCoords(std::span<const math::XMFLOAT2> textureCoords)
+    {
+        std::vector<uint32_t> encodedTextureCoords{};
+        encodedTextureCoords.reserve(textureCoords.size());
+
+        for (const math::XMFLOAT2& textureCoord : textureCoords)
+        {
+            const uint32_t x = math::PackedVector::XMConvertFloatToHalf(textureCoord.x);
+            const uint32_t y = math::PackedVector::XMConvertFloatToHalf(textureCoord.y);
+
+            encodedTextureCoords.emplace_back(x | (y << 16u));
+        }
+
+        return encodedTextureCoords;
+    }
+} // namespace helios::scene
@@ -54,6 +54,15 @@ class SandBox final : public helios::core::Application
                                                               0.1f,
                                                               0.1f,
                                                           },
+                                                      .cookSettings =
+                                                          {
+                                                              .optimizeMeshes = true,
+                                                              .buildMeshlets = true,
+                                                              .lodCount = 4u,
+                                                          },
+                                                      .quantizeVertexStreams = true,
+                                                      .compressTextures = true,
+                                                      .streamTextures = true,
                                                   });
 
         m_scene->addLight(
@@ -171,9 +180,12 @@ class SandBox final : public helios::core::Application
 
     void update(const float deltaTime) override
     {
-        m_scene->update(deltaTime, m_input, static_cast<float>(m_windowWidth) / m_windowHeight);
+        m_scene->pollResourceLoading(m_graphicsDevice.get());
+        m_scene->update(m_graphicsDevice.get(), deltaTime, m_input, m_windowWidth, m_windowHeight);
+        m_scene->streamTextures(m_graphicsDevice.get());
+        m_scene->updateMaterials(m_graphicsDevice.get());
 
-        m_postProcessingBuffer.update(&m_postProcessingBufferData);
+        m_postProcessingBuffer = m_graphicsDevice->allocateFrameConstants(m_postProcessingBufferData);
     }
 
     void render() override
@@ -244,11 +256,14 @@ class SandBox final : public helios::core::Application
         shadingPassContext->setComputeRootSignature();
         postProcessingContext->setGraphicsRootSignature();
 
+        // The command lists of the render passes are recorded in parallel by the job system (forked jobs run on the
+        // parked worker threads, and the render thread helps with the forked jobs while it joins them).
+        core::JobSystem& jobSystem = core::JobSystem::get();
+
         // RenderPass 2 : Shadow mapping pass.
-        std::thread shadowMappingPassThread =
-            std::thread([&]() { m_shadowMappingPass->render(m_scene.value(), shadowContext.get()); });
+        const auto shadowMappingPass = [&]() { m_shadowMappingPass->render(m_scene.value(), shadowContext.get()); };
 
-        std::thread deferredAndLightCubeMapThread = std::thread([&]() {
+        const auto deferredAndLightCubeMapPass = [&]() {
             {
                 // RenderPass 0 : Deferred GPass.
                 {
@@ -274,10 +289,10 @@ class SandBox final : public helios::core::Application
                     m_scene->renderCubeMap(gctx.get());
                 }
             }
-        });
+        };
 
         // RenderPass 3 : SSAO Pass.
-        std::thread ssaoPassThread = std::thread([&]() {
+        const auto ssaoPass = [&]() {
             ssaoContext->addResourceBarrier(m_depthTexture.allocation.resource.Get(), D3D12_RESOURCE_STATE_DEPTH_WRITE,
                                             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
@@ -296,19 +311,25 @@ class SandBox final : public helios::core::Application
             ssaoContext->setComputeRootSignature();
 
             m_ssaoPass->render(ssaoContext.get(), renderResources, m_windowWidth, m_windowHeight);
-        });
+        };
 
-        deferredAndLightCubeMapThread.join();
-        shadowMappingPassThread.join();
+        core::JobCounter deferredAndShadowPassCounter{};
+        core::JobCounter renderPassCounter{};
+
+        jobSystem.fork(shadowMappingPass, deferredAndShadowPassCounter);
+        jobSystem.fork(deferredAndLightCubeMapPass, deferredAndShadowPassCounter);
+        jobSystem.fork(ssaoPass, renderPassCounter);
+
+        jobSystem.join(deferredAndShadowPassCounter);
         const std::array<gfx::Context* const, 2u> deferredPassAndlightAndCubeMapContexts = {
             gctx.get(),
             shadowContext.get(),
 
         };
 
-        m_graphicsDevice->getDirectCommandQueue()->executeContext(deferredPassAndlightAndCubeMapContexts);
+        m_graphicsDevice->executeContexts(deferredPassAndlightAndCubeMapContexts);
 
-        std::thread shadingPassThread = std::thread([&]() {
+        const auto shadingPass = [&]() {
             // Transition all resources that are required for the shading pass but not in the appropriate resource
             // state.
             shadingPassContext->addResourceBarrier(m_ssaoPass->m_blurSSAOTexture.allocation.resource.Get(),
@@ -375,10 +396,10 @@ class SandBox final : public helios::core::Application
                 m_bloomPass->render(shadingPassContext.get(), m_offscreenRenderTarget, m_lightAndCubeMapRenderTarget,
                                     m_windowWidth, m_windowHeight);
             }
-        });
+        };
 
         // RenderPass 6 : Post Processing Stage:
-        std::thread postProcessingThread = std::thread([&]() {
+        const auto postProcessingPass = [&]() {
             {
                 postProcessingContext->setGraphicsRootSignatureAndPipeline(m_postProcessingPipelineState);
                 postProcessingContext->setViewport(D3D12_VIEWPORT{
@@ -460,16 +481,17 @@ class SandBox final : public helios::core::Application
 
                 postProcessingContext->executeResourceBarriers();
             }
-        });
+        };
+
+        jobSystem.fork(shadingPass, renderPassCounter);
+        jobSystem.fork(postProcessingPass, renderPassCounter);
 
-        ssaoPassThread.join();
-        shadingPassThread.join();
-        postProcessingThread.join();
+        jobSystem.join(renderPassCounter);
 
         const std::array<gfx::Context* const, 3u> contexts = {ssaoContext.get(), shadingPassContext.get(),
                                                               postProcessingContext.get()};
 
-        m_graphicsDevice->getDirectCommandQueue()->executeContext(contexts);
+        m_graphicsDevice->executeContexts(contexts);
 
         m_graphicsDevice->present();
         m_graphicsDevice->endFrame();
@@ -494,7 +516,7 @@ class SandBox final : public helios::core::Application
 
     gfx::Buffer m_renderTargetIndexBuffer{};
 
-    gfx::Buffer m_postProcessingBuffer{};
+    gfx::FrameConstantBuffer m_postProcessingBuffer{};
     interlop::PostProcessingBuffer m_postProcessingBufferData{};
 
     std::optional<rendering::DeferredGeometryPass> m_deferredGPass{};
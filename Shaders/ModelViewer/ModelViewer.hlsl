@@ -4,6 +4,8 @@
 #include "RootSignature/BindlessRS.hlsli"
 #include "ShaderInterlop/ConstantBuffers.hlsli"
 #include "ShaderInterlop/RenderResources.hlsli"
+#include "Transforms.hlsli"
+#include "VertexStreams.hlsli"
 
 struct VSOutput
 {
@@ -15,16 +17,15 @@ ConstantBuffer<interlop::ModelViewerRenderResources> renderResources : register(
 
 [RootSignature(BindlessRootSignature)] VSOutput VsMain(uint vertexID: SV_VertexID) 
 {
-    StructuredBuffer<float3> positionBuffer = ResourceDescriptorHeap[renderResources.positionBufferIndex];
-    StructuredBuffer<float2> textureCoordBuffer = ResourceDescriptorHeap[renderResources.textureCoordBufferIndex];
-
     ConstantBuffer<interlop::SceneBuffer> sceneBuffer = ResourceDescriptorHeap[renderResources.sceneBufferIndex];
-    ConstantBuffer<interlop::TransformBuffer> transformBuffer = ResourceDescriptorHeap[renderResources.transformBufferIndex];
+    const float4x4 modelMatrix = loadModelMatrix(renderResources.transformBufferIndex, renderResources.transformIndex);
     
     VSOutput output;
 
-    output.position = mul(mul(float4(positionBuffer[vertexID].xyz, 1.0f), transformBuffer.modelMatrix), sceneBuffer.viewProjectionMatrix);
-    output.textureCoord = textureCoordBuffer[vertexID];
+    const float3 position = loadPosition(renderResources.positionBufferIndex, renderResources.meshBufferIndex, vertexID);
+
+    output.position = mul(mul(float4(position, 1.0f), modelMatrix), sceneBuffer.viewProjectionMatrix);
+    output.textureCoord = loadTextureCoord(renderResources.textureCoordBufferIndex, renderResources.meshBufferIndex, vertexID);
 
     return output;
 }
@@ -3,7 +3,9 @@
 #include "RootSignature/BindlessRS.hlsli"
 #include "ShaderInterlop/ConstantBuffers.hlsli"
 #include "ShaderInterlop/RenderResources.hlsli"
+#include "Transforms.hlsli"
 #include "Utils.hlsli"
+#include "VertexStreams.hlsli"
 
 struct VSOutput
 {
@@ -20,21 +22,19 @@ ConstantBuffer<interlop::DeferredGPassRenderResources> renderResources : registe
 [RootSignature(BindlessRootSignature)] 
 VSOutput VsMain(uint vertexID : SV_VertexID) 
 {
-    StructuredBuffer<float3> positionBuffer = ResourceDescriptorHeap[renderResources.positionBufferIndex];
-    StructuredBuffer<float2> textureCoordBuffer = ResourceDescriptorHeap[renderResources.textureCoordBufferIndex];
-    StructuredBuffer<float3> normalBuffer = ResourceDescriptorHeap[renderResources.normalBufferIndex];
-
     ConstantBuffer<interlop::SceneBuffer> sceneBuffer = ResourceDescriptorHeap[renderResources.sceneBufferIndex];
-    ConstantBuffer<interlop::TransformBuffer> transformBuffer = ResourceDescriptorHeap[renderResources.transformBufferIndex];
 
-    const matrix mvpMatrix = mul(transformBuffer.modelMatrix, sceneBuffer.viewProjectionMatrix);
-    const matrix mvMatrix = mul(transformBuffer.modelMatrix, sceneBuffer.viewMatrix);
-    const float3x3 normalMatrix = (float3x3)transpose(transformBuffer.inverseModelMatrix);
+    const float4x4 modelMatrix = loadModelMatrix(renderResources.transformBufferIndex, renderResources.transformIndex);
+    const float4x4 inverseModelMatrix = loadInverseModelMatrix(renderResources.transformBufferIndex, renderResources.transformIndex);
+
+    const matrix mvpMatrix = mul(modelMatrix, sceneBuffer.viewProjectionMatrix);
+    const matrix mvMatrix = mul(modelMatrix, sceneBuffer.viewMatrix);
+    const float3x3 normalMatrix = (float3x3)transpose(inverseModelMatrix);
 
     VSOutput output;
-    output.position = mul(float4(positionBuffer[vertexID], 1.0f), mvpMatrix);
-    output.textureCoord = textureCoordBuffer[vertexID];
-    output.normal = normalBuffer[vertexID];
+    output.position = mul(float4(loadPosition(renderResources.positionBufferIndex, renderResources.meshBufferIndex, vertexID), 1.0f), mvpMatrix);
+    output.textureCoord = loadTextureCoord(renderResources.textureCoordBufferIndex, renderResources.meshBufferIndex, vertexID);
+    output.normal = loadNormal(renderResources.normalBufferIndex, renderResources.meshBufferIndex, vertexID);
     output.worldSpaceNormal = normalize(mul(output.normal, normalMatrix));
     output.viewMatrix = (float3x3)sceneBuffer.viewMatrix;
 
@@ -65,27 +65,29 @@ struct PsOutput
 [RootSignature(BindlessRootSignature)] 
 PsOutput PsMain(VSOutput psInput) 
 {
-    ConstantBuffer<interlop::MaterialBuffer> materialBuffer = ResourceDescriptorHeap[renderResources.materialBufferIndex];
+    StructuredBuffer<interlop::MaterialData> materialTable = ResourceDescriptorHeap[renderResources.materialTableIndex];
+    const interlop::MaterialData material = materialTable[renderResources.materialIndex];
 
     PsOutput output;
 
-    output.albedoEmissive = getAlbedo(psInput.textureCoord, renderResources.albedoTextureIndex, renderResources.albedoTextureSamplerIndex, materialBuffer.albedoColor);
+    output.albedoEmissive = getAlbedo(psInput.textureCoord, material.albedoTextureIndex, material.albedoTextureSamplerIndex, material.albedoColor);
     
+    // Keep in sync with ALPHA_TEST_CUTOFF (the alpha coverage of the albedo mip chain is preserved for this cutoff).
     if (output.albedoEmissive.a < 0.9f)
     {
         discard;
     }
 
-    float3 emissive = getEmissive(psInput.textureCoord, output.albedoEmissive.xyz, materialBuffer.emissiveFactor, renderResources.emissiveTextureIndex, renderResources.emissiveTextureSamplerIndex);
+    float3 emissive = getEmissive(psInput.textureCoord, output.albedoEmissive.xyz, material.emissiveFactor, material.emissiveTextureIndex, material.emissiveTextureSamplerIndex);
 
     output.albedoEmissive = float4(output.albedoEmissive.xyz, emissive.r);
    
 
-    output.normalEmissive = float4(getNormal(psInput.textureCoord, renderResources.normalTextureIndex, renderResources.normalTextureSamplerIndex, psInput.normal, psInput.worldSpaceNormal, psInput.tbnMatrix), emissive.g);
+    output.normalEmissive = float4(getNormal(psInput.textureCoord, material.normalTextureIndex, material.normalTextureSamplerIndex, psInput.normal, psInput.worldSpaceNormal, psInput.tbnMatrix), emissive.g);
     output.normalEmissive.xyz = mul(output.normalEmissive.xyz, psInput.viewMatrix);
 
-    float ao = getAO(psInput.textureCoord, renderResources.aoTextureIndex, renderResources.aoTextureSamplerIndex);
-    float2 metalRoughness = getMetalRoughness(psInput.textureCoord, renderResources.metalRoughnessTextureIndex, renderResources.metalRoughnessTextureSamplerIndex) * float2(materialBuffer.metallicFactor, materialBuffer.roughnessFactor);
+    float ao = getAO(psInput.textureCoord, material.aoTextureIndex, material.aoTextureSamplerIndex);
+    float2 metalRoughness = getMetalRoughness(psInput.textureCoord, material.metalRoughnessTextureIndex, material.metalRoughnessTextureSamplerIndex) * float2(material.metallicFactor, material.roughnessFactor);
 
     output.aoMetalRoughnessEmissive = float4(ao, metalRoughness, emissive.b);
 
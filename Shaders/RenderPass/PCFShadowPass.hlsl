@@ -3,7 +3,9 @@
 #include "RootSignature/BindlessRS.hlsli"
 #include "ShaderInterlop/ConstantBuffers.hlsli"
 #include "ShaderInterlop/RenderResources.hlsli"
+#include "Transforms.hlsli"
 #include "Utils.hlsli"
+#include "VertexStreams.hlsli"
 
 struct VSOutput
 {
@@ -15,15 +17,13 @@ ConstantBuffer<interlop::ShadowPassRenderResources> renderResources : register(b
 [RootSignature(BindlessRootSignature)] 
 VSOutput VsMain(uint vertexID : SV_VertexID) 
 {
-    StructuredBuffer<float3> positionBuffer = ResourceDescriptorHeap[renderResources.positionBufferIndex];
-    
-    ConstantBuffer<interlop::TransformBuffer> transformBuffer = ResourceDescriptorHeap[renderResources.transformBufferIndex];
     ConstantBuffer<interlop::ShadowBuffer> shadowBuffer = ResourceDescriptorHeap[renderResources.shadowBufferIndex];
 
-    const matrix mvpMatrix = mul(transformBuffer.modelMatrix, shadowBuffer.lightViewProjectionMatrix);
+    const float4x4 modelMatrix = loadModelMatrix(renderResources.transformBufferIndex, renderResources.transformIndex);
+    const matrix mvpMatrix = mul(modelMatrix, shadowBuffer.lightViewProjectionMatrix);
 
     VSOutput output;
-    output.position = mul(float4(positionBuffer[vertexID], 1.0f), mvpMatrix);
+    output.position = mul(float4(loadPosition(renderResources.positionBufferIndex, renderResources.meshBufferIndex, vertexID), 1.0f), mvpMatrix);
     return output;
 }
 
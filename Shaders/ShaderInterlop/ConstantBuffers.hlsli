@@ -35,10 +35,14 @@ namespace interlop
         float4x4 inverseViewMatrix;
     };
 
-    ConstantBufferStruct TransformBuffer
+    // Per mesh data required to decode the vertex streams (see VertexStreams.hlsli).
+    ConstantBufferStruct MeshBuffer
     {
-        float4x4 modelMatrix;
-        float4x4 inverseModelMatrix;
+        // Quantized positions are decoded as positionMin + unormPosition * positionExtent.
+        float3 positionMin;
+        uint isQuantized;
+        float3 positionExtent;
+        float padding;
     };
 
     enum class TextureDimensionType
@@ -102,16 +106,37 @@ namespace interlop
         float4 padding;
     };
 
-    // Note : By using the values in this buffer, the PBR renderer will most likely 'break' and become physically inaccurate.
-    // These are used for debugging and testing purposes only.
-    ConstantBufferStruct MaterialBuffer
+    // Element of the material table (a structured buffer, see scene::MaterialTable), not a ConstantBufferStruct.
+    // Texture and sampler indices are INVALID_INDEX_U32 if the material does not have that texture.
+    struct MaterialData
     {
+        // Note : By using these factors, the PBR renderer will most likely 'break' and become physically inaccurate.
+        // These are used for debugging and testing purposes only.
         float roughnessFactor;
         float metallicFactor;
         float emissiveFactor;
         float padding;
         float3 albedoColor;
         float padding2;
+
+        uint albedoTextureIndex;
+        uint albedoTextureSamplerIndex;
+
+        uint metalRoughnessTextureIndex;
+        uint metalRoughnessTextureSamplerIndex;
+
+        uint normalTextureIndex;
+        uint normalTextureSamplerIndex;
+
+        uint aoTextureIndex;
+        uint aoTextureSamplerIndex;
+
+        uint emissiveTextureIndex;
+        uint emissiveTextureSamplerIndex;
+
+        // The size of the struct is kept a multiple of 16 bytes.
+        uint padding3;
+        uint padding4;
     };
 
     ConstantBufferStruct ShadowBuffer
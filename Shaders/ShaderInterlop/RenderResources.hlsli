@@ -31,9 +31,11 @@ namespace interlop
     {
         uint sceneBufferIndex;
         uint transformBufferIndex;
+        uint transformIndex;
         uint positionBufferIndex;
         uint normalBufferIndex;
         uint textureCoordBufferIndex;
+        uint meshBufferIndex;
         uint albedoTextureIndex;    
         uint albedoTextureSamplerIndex;
     };
@@ -79,27 +81,16 @@ namespace interlop
         uint positionBufferIndex;
         uint textureCoordBufferIndex;
         uint normalBufferIndex;
+        uint meshBufferIndex;
 
         uint transformBufferIndex;
+        uint transformIndex;
 
         uint sceneBufferIndex;
 
-        uint albedoTextureIndex;
-        uint albedoTextureSamplerIndex;
-
-        uint metalRoughnessTextureIndex;
-        uint metalRoughnessTextureSamplerIndex;
-
-        uint normalTextureIndex;
-        uint normalTextureSamplerIndex;
-
-        uint aoTextureIndex;
-        uint aoTextureSamplerIndex;
-
-        uint emissiveTextureIndex;
-        uint emissiveTextureSamplerIndex;
-
-        uint materialBufferIndex;
+        // The textures, samplers and factors of the material are read from the material table.
+        uint materialTableIndex;
+        uint materialIndex;
     };
 
     struct PBRRenderResources
@@ -158,7 +149,9 @@ namespace interlop
     struct ShadowPassRenderResources
     {
         uint positionBufferIndex;
+        uint meshBufferIndex;
         uint transformBufferIndex;
+        uint transformIndex;
         uint shadowBufferIndex;
     };
    
@@ -0,0 +1,24 @@
+// clang-format off
+#pragma once
+
+// Functions to read the transforms of the scene (see scene::TransformStore). The transform buffer is a StructuredBuffer<float4x4>
+// holding the model matrices of all transforms, followed by the inverse model matrices (so passes that only need the model matrix
+// read a contiguous array).
+
+float4x4 loadModelMatrix(const uint transformBufferIndex, const uint transformIndex)
+{
+    StructuredBuffer<float4x4> transformBuffer = ResourceDescriptorHeap[transformBufferIndex];
+
+    return transformBuffer[transformIndex];
+}
+
+float4x4 loadInverseModelMatrix(const uint transformBufferIndex, const uint transformIndex)
+{
+    StructuredBuffer<float4x4> transformBuffer = ResourceDescriptorHeap[transformBufferIndex];
+
+    uint matrixCount = 0u;
+    uint stride = 0u;
+    transformBuffer.GetDimensions(matrixCount, stride);
+
+    return transformBuffer[matrixCount / 2u + transformIndex];
+}
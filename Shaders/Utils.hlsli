@@ -33,8 +33,10 @@ float3 getNormal(float2 textureCoord, uint normalTextureIndex, uint normalTextur
 
         SamplerState samplerState = SamplerDescriptorHeap[NonUniformResourceIndex(normalTextureSamplerIndex)];
 
-        // Make the normal into a -1 to 1 range.
-        normal = 2.0f * normalTexture.Sample(samplerState, textureCoord).xyz - float3(1.0f, 1.0f, 1.0f);
+        // Make the normal into a -1 to 1 range. Only the x and y components are read, and z is reconstructed, so that
+        // two channel (BC5) normal maps are supported.
+        const float2 normalXY = 2.0f * normalTexture.Sample(samplerState, textureCoord).xy - float2(1.0f, 1.0f);
+        normal = float3(normalXY, sqrt(saturate(1.0f - dot(normalXY, normalXY))));
         normal = normalize(mul(normal, tbnMatrix));
         return normal;
     }
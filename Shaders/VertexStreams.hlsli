@@ -0,0 +1,71 @@
+// clang-format off
+#pragma once
+
+// Functions to read the vertex streams of a mesh. If the mesh is quantized (MeshBuffer::isQuantized), the stream layouts are :
+// position : uint2 (3 x 16 bit unorm relative to the mesh AABB, last 16 bits unused).
+// normal : uint (octahedral encoded, 2 x 16 bit snorm).
+// texture coord : uint (2 x half).
+// Else, the streams are float3 / float3 / float2.
+// Requires ShaderInterlop/ConstantBuffers.hlsli to be included before this file.
+
+float2 unpackSnorm16x2(const uint packedValue)
+{
+    const int2 values = int2(packedValue << 16, packedValue) >> 16;
+    return max(float2(values) / 32767.0f, -1.0f);
+}
+
+float3 decodeOctahedralNormal(const float2 encodedNormal)
+{
+    float3 normal = float3(encodedNormal.xy, 1.0f - abs(encodedNormal.x) - abs(encodedNormal.y));
+    const float t = saturate(-normal.z);
+    normal.xy += select(normal.xy >= 0.0f, -t, t);
+
+    return normalize(normal);
+}
+
+float3 loadPosition(const uint positionBufferIndex, const uint meshBufferIndex, const uint vertexID)
+{
+    ConstantBuffer<interlop::MeshBuffer> meshBuffer = ResourceDescriptorHeap[meshBufferIndex];
+
+    if (meshBuffer.isQuantized)
+    {
+        StructuredBuffer<uint2> positionBuffer = ResourceDescriptorHeap[positionBufferIndex];
+        const uint2 quantizedPosition = positionBuffer[vertexID];
+
+        const float3 unormPosition = float3(quantizedPosition.x & 0xFFFF, quantizedPosition.x >> 16, quantizedPosition.y & 0xFFFF) / 65535.0f;
+        return meshBuffer.positionMin + unormPosition * meshBuffer.positionExtent;
+    }
+
+    StructuredBuffer<float3> positionBuffer = ResourceDescriptorHeap[positionBufferIndex];
+    return positionBuffer[vertexID];
+}
+
+float3 loadNormal(const uint normalBufferIndex, const uint meshBufferIndex, const uint vertexID)
+{
+    ConstantBuffer<interlop::MeshBuffer> meshBuffer = ResourceDescriptorHeap[meshBufferIndex];
+
+    if (meshBuffer.isQuantized)
+    {
+        StructuredBuffer<uint> normalBuffer = ResourceDescriptorHeap[normalBufferIndex];
+        return decodeOctahedralNormal(unpackSnorm16x2(normalBuffer[vertexID]));
+    }
+
+    StructuredBuffer<float3> normalBuffer = ResourceDescriptorHeap[normalBufferIndex];
+    return normalBuffer[vertexID];
+}
+
+float2 loadTextureCoord(const uint textureCoordBufferIndex, const uint meshBufferIndex, const uint vertexID)
+{
+    ConstantBuffer<interlop::MeshBuffer> meshBuffer = ResourceDescriptorHeap[meshBufferIndex];
+
+    if (meshBuffer.isQuantized)
+    {
+        StructuredBuffer<uint> textureCoordBuffer = ResourceDescriptorHeap[textureCoordBufferIndex];
+        const uint packedTextureCoord = textureCoordBuffer[vertexID];
+
+        return float2(f16tof32(packedTextureCoord & 0xFFFF), f16tof32(packedTextureCoord >> 16));
+    }
+
+    StructuredBuffer<float2> textureCoordBuffer = ResourceDescriptorHeap[textureCoordBufferIndex];
+    return textureCoordBuffer[vertexID];
+}